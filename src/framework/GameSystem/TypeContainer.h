@@ -29,12 +29,13 @@
 #include <vector>
 #include "Common.h"
 #include "Utilities/TypeList.h"
+#include "Utilities/FlatHandleMap.h"
 #include "GameSystem/GridRefManager.h"
 
 template<class OBJECT, class KEY_TYPE>
 struct ContainerUnorderedMap
 {
-    std::unordered_map<KEY_TYPE, OBJECT*> _element;
+    FlatHandleMap<KEY_TYPE, OBJECT> _element;
 };
 
 template<class KEY_TYPE>
@@ -73,13 +74,13 @@ class TypeUnorderedMapContainer
         }
 
         template<class SPECIFIC_TYPE>
-        typename std::unordered_map<KEY_TYPE, SPECIFIC_TYPE*>::iterator begin()
+        typename FlatHandleMap<KEY_TYPE, SPECIFIC_TYPE>::iterator begin()
         {
             return i_elements._elements._element.begin();
         }
 
         template<class SPECIFIC_TYPE>
-        typename std::unordered_map<KEY_TYPE, SPECIFIC_TYPE*>::iterator end()
+        typename FlatHandleMap<KEY_TYPE, SPECIFIC_TYPE>::iterator end()
         {
             return i_elements._elements._element.end();
         }
@@ -93,13 +94,9 @@ class TypeUnorderedMapContainer
         template<class SPECIFIC_TYPE>
         static bool insert(ContainerUnorderedMap<SPECIFIC_TYPE, KEY_TYPE>& elements, KEY_TYPE handle, SPECIFIC_TYPE* obj)
         {
-            typename std::unordered_map<KEY_TYPE, SPECIFIC_TYPE*>::iterator i = elements._element.find(handle);
-            if (i == elements._element.end())
-            {
-                elements._element[handle] = obj;
+            if (elements._element.insert(handle, obj))
                 return true;
-            }
-            assert(i->second == obj && "Object with certain key already in but objects are different!");
+            assert(elements._element.find(handle) == obj && "Object with certain key already in but objects are different!");
             return false;
         }
 
@@ -126,10 +123,7 @@ class TypeUnorderedMapContainer
         template<class SPECIFIC_TYPE>
         static SPECIFIC_TYPE* find(ContainerUnorderedMap<SPECIFIC_TYPE, KEY_TYPE>& elements, KEY_TYPE hdl, SPECIFIC_TYPE* /*obj*/)
         {
-            typename std::unordered_map<KEY_TYPE, SPECIFIC_TYPE*>::iterator i = elements._element.find(hdl);
-            if (i == elements._element.end())
-                return nullptr;
-            return i->second;
+            return elements._element.find(hdl);
         }
 
         template<class SPECIFIC_TYPE>
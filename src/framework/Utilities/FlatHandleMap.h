@@ -0,0 +1,202 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_FLATHANDLEMAP_H
+#define MANGOS_FLATHANDLEMAP_H
+
+#include "Platform/Define.h"
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/*
+ * @class FlatHandleMap is an open addressing hash table mapping 64 bit handles
+ * (object guids) to object pointers. All entries live in one contiguous array,
+ * so a lookup is usually a single cache line and insertion never allocates
+ * until the table grows.
+ *
+ * Collisions are resolved by linear probing. Erase shifts following entries of
+ * the probe chain back instead of leaving tombstones, so lookups never degrade
+ * on maps with heavy spawn/despawn churn.
+ *
+ * Handle value 0 marks an empty slot and can't be stored. Slots move on erase
+ * and growth, only the stored pointers are stable.
+ */
+template<class KEY_TYPE, class OBJECT>
+class FlatHandleMap
+{
+    public:
+        typedef std::pair<KEY_TYPE, OBJECT*> value_type;
+
+    private:
+        typedef std::vector<value_type> SlotContainer;
+
+    public:
+        class iterator
+        {
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef typename FlatHandleMap::value_type value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef value_type* pointer;
+                typedef value_type& reference;
+
+                iterator() : m_cur(nullptr), m_end(nullptr) {}
+                iterator(value_type* cur, value_type* end) : m_cur(cur), m_end(end) { skipEmpty(); }
+
+                reference operator*() const { return *m_cur; }
+                pointer operator->() const { return m_cur; }
+
+                iterator& operator++() { ++m_cur; skipEmpty(); return *this; }
+                iterator operator++(int) { iterator tmp = *this; ++(*this); return tmp; }
+
+                bool operator==(iterator const& other) const { return m_cur == other.m_cur; }
+                bool operator!=(iterator const& other) const { return m_cur != other.m_cur; }
+
+            private:
+                void skipEmpty()
+                {
+                    while (m_cur != m_end && uint64(m_cur->first) == 0)
+                        ++m_cur;
+                }
+
+                value_type* m_cur;
+                value_type* m_end;
+        };
+
+        FlatHandleMap() : m_size(0) {}
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        iterator begin() { return m_slots.empty() ? iterator() : iterator(&m_slots[0], &m_slots[0] + m_slots.size()); }
+        iterator end() { return m_slots.empty() ? iterator() : iterator(&m_slots[0] + m_slots.size(), &m_slots[0] + m_slots.size()); }
+
+        OBJECT* find(KEY_TYPE handle) const
+        {
+            if (m_slots.empty())
+                return nullptr;
+
+            size_t const mask = m_slots.size() - 1;
+            for (size_t i = hashIndex(handle, mask);; i = (i + 1) & mask)
+            {
+                value_type const& slot = m_slots[i];
+                if (uint64(slot.first) == uint64(handle))
+                    return slot.second;
+                if (uint64(slot.first) == 0)
+                    return nullptr;
+            }
+        }
+
+        /// returns false and leaves the table unchanged if handle is already present
+        bool insert(KEY_TYPE handle, OBJECT* obj)
+        {
+            // keep load factor at or below 1/2, probe chains stay short
+            if ((m_size + 1) * 2 > m_slots.size())
+                grow();
+
+            size_t const mask = m_slots.size() - 1;
+            for (size_t i = hashIndex(handle, mask);; i = (i + 1) & mask)
+            {
+                value_type& slot = m_slots[i];
+                if (uint64(slot.first) == uint64(handle))
+                    return false;
+                if (uint64(slot.first) == 0)
+                {
+                    slot.first = handle;
+                    slot.second = obj;
+                    ++m_size;
+                    return true;
+                }
+            }
+        }
+
+        bool erase(KEY_TYPE handle)
+        {
+            if (m_slots.empty())
+                return false;
+
+            size_t const mask = m_slots.size() - 1;
+            size_t hole = hashIndex(handle, mask);
+            while (uint64(m_slots[hole].first) != uint64(handle))
+            {
+                if (uint64(m_slots[hole].first) == 0)
+                    return false;
+                hole = (hole + 1) & mask;
+            }
+
+            // backward shift: move every following entry of the chain whose home slot
+            // is not between the hole and its current position into the hole
+            for (size_t i = (hole + 1) & mask; uint64(m_slots[i].first) != 0; i = (i + 1) & mask)
+            {
+                size_t const home = hashIndex(m_slots[i].first, mask);
+                if (((i - home) & mask) >= ((i - hole) & mask))
+                {
+                    m_slots[hole] = m_slots[i];
+                    hole = i;
+                }
+            }
+
+            m_slots[hole] = value_type(KEY_TYPE(), nullptr);
+            --m_size;
+            return true;
+        }
+
+        void clear()
+        {
+            SlotContainer().swap(m_slots);
+            m_size = 0;
+        }
+
+    private:
+        // 64 bit finalizer (splitmix64), guid counters are sequential and need proper mixing
+        static size_t hashIndex(KEY_TYPE handle, size_t mask)
+        {
+            uint64 h = uint64(handle);
+            h = (h ^ (h >> 30)) * uint64(0xbf58476d1ce4e5b9ULL);
+            h = (h ^ (h >> 27)) * uint64(0x94d049bb133111ebULL);
+            h ^= h >> 31;
+            return size_t(h) & mask;
+        }
+
+        void grow()
+        {
+            SlotContainer old;
+            old.swap(m_slots);
+            m_slots.resize(old.empty() ? 64 : old.size() * 2, value_type(KEY_TYPE(), nullptr));
+
+            size_t const mask = m_slots.size() - 1;
+            for (value_type const& slot : old)
+            {
+                if (uint64(slot.first) == 0)
+                    continue;
+
+                size_t i = hashIndex(slot.first, mask);
+                while (uint64(m_slots[i].first) != 0)
+                    i = (i + 1) & mask;
+                m_slots[i] = slot;
+            }
+        }
+
+        SlotContainer m_slots;
+        size_t m_size;
+};
+
+#endif
@@ -440,6 +440,7 @@ bool AchievementCriteriaRequirementSet::Meets(Player const* source, Unit const*
 AchievementMgr::AchievementMgr(Player* player)
 {
     m_player = player;
+    m_completedAchievementsDataValid = false;
 }
 
 AchievementMgr::~AchievementMgr()
@@ -463,6 +464,7 @@ void AchievementMgr::Reset()
     }
 
     m_completedAchievements.clear();
+    m_completedAchievementsDataValid = false;
     m_criteriaProgress.clear();
     DeleteFromDB(m_player->GetObjectGuid());
 
@@ -567,58 +569,62 @@ void AchievementMgr::DeleteFromDB(ObjectGuid guid)
 
 void AchievementMgr::SaveToDB()
 {
-    static SqlStatementID delComplAchievements ;
-    static SqlStatementID insComplAchievements ;
-    static SqlStatementID delProgress ;
-    static SqlStatementID insProgress ;
+    static SqlStatementID replaceComplAchievements ;
+    static SqlStatementID replaceProgress ;
 
-    if (!m_completedAchievements.empty())
-    {
-        // delete existing achievements in the loop
-        for (auto& m_completedAchievement : m_completedAchievements)
-        {
-            if (!m_completedAchievement.second.changed)
-                continue;
+    uint32 lowGuid = GetPlayer()->GetGUIDLow();
 
-            /// mark as saved in db
-            m_completedAchievement.second.changed = false;
+    // only rows changed since last save are written, as single upserts so the
+    // player save transaction can send each table as one multi-row request
+    for (auto& m_completedAchievement : m_completedAchievements)
+    {
+        if (!m_completedAchievement.second.changed)
+            continue;
 
-            SqlStatement stmt = CharacterDatabase.CreateStatement(delComplAchievements, "DELETE FROM character_achievement WHERE guid = ? AND achievement = ?");
-            stmt.PExecute(GetPlayer()->GetGUIDLow(), m_completedAchievement.first);
+        /// mark as saved in db
+        m_completedAchievement.second.changed = false;
 
-            stmt = CharacterDatabase.CreateStatement(insComplAchievements, "INSERT INTO character_achievement (guid, achievement, date) VALUES (?, ?, ?)");
-            stmt.PExecute(GetPlayer()->GetGUIDLow(), m_completedAchievement.first, uint64(m_completedAchievement.second.date));
-        }
+        SqlStatement stmt = CharacterDatabase.CreateStatement(replaceComplAchievements, "REPLACE INTO character_achievement (guid, achievement, date) VALUES (?, ?, ?)");
+        stmt.PExecute(lowGuid, m_completedAchievement.first, uint64(m_completedAchievement.second.date));
     }
 
-    if (!m_criteriaProgress.empty())
-    {
-        // insert achievements
-        for (auto& m_criteriaProgres : m_criteriaProgress)
-        {
-            if (!m_criteriaProgres.second.changed)
-                continue;
+    std::vector<uint32> removedCriteria;
 
-            /// mark as updated in db
-            m_criteriaProgres.second.changed = false;
+    for (auto& m_criteriaProgres : m_criteriaProgress)
+    {
+        if (!m_criteriaProgres.second.changed)
+            continue;
 
-            // new/changed record data
-            SqlStatement stmt = CharacterDatabase.CreateStatement(delProgress, "DELETE FROM character_achievement_progress WHERE guid = ? AND criteria = ?");
-            stmt.PExecute(GetPlayer()->GetGUIDLow(), m_criteriaProgres.first);
+        /// mark as updated in db
+        m_criteriaProgres.second.changed = false;
 
-            bool needSave = m_criteriaProgres.second.counter != 0;
-            if (!needSave)
-            {
-                AchievementCriteriaEntry const* criteria = sAchievementCriteriaStore.LookupEntry(m_criteriaProgres.first);
-                needSave = criteria && criteria->timeLimit > 0;
-            }
+        bool needSave = m_criteriaProgres.second.counter != 0;
+        if (!needSave)
+        {
+            AchievementCriteriaEntry const* criteria = sAchievementCriteriaStore.LookupEntry(m_criteriaProgres.first);
+            needSave = criteria && criteria->timeLimit > 0;
+        }
 
-            if (needSave)
-            {
-                stmt = CharacterDatabase.CreateStatement(insProgress, "INSERT INTO character_achievement_progress (guid, criteria, counter, date) VALUES (?, ?, ?, ?)");
-                stmt.PExecute(GetPlayer()->GetGUIDLow(), m_criteriaProgres.first, m_criteriaProgres.second.counter, uint64(m_criteriaProgres.second.date));
-            }
+        if (!needSave)
+        {
+            removedCriteria.push_back(m_criteriaProgres.first);
+            continue;
         }
+
+        // new/changed record data
+        SqlStatement stmt = CharacterDatabase.CreateStatement(replaceProgress, "REPLACE INTO character_achievement_progress (guid, criteria, counter, date) VALUES (?, ?, ?, ?)");
+        stmt.PExecute(lowGuid, m_criteriaProgres.first, m_criteriaProgres.second.counter, uint64(m_criteriaProgres.second.date));
+    }
+
+    // progress reset to zero (failed timed criteria), all removed by one request
+    if (!removedCriteria.empty())
+    {
+        std::ostringstream ss;
+        ss << "DELETE FROM character_achievement_progress WHERE guid = " << lowGuid << " AND criteria IN (";
+        for (size_t i = 0; i < removedCriteria.size(); ++i)
+            ss << (i ? "," : "") << removedCriteria[i];
+        ss << ")";
+        CharacterDatabase.Execute(ss.str().c_str());
     }
 }
 
@@ -644,6 +650,8 @@ void AchievementMgr::LoadFromDB(QueryResult* achievementResult, QueryResult* cri
             ca.changed = false;
         }
         while (achievementResult->NextRow());
+
+        m_completedAchievementsDataValid = false;
         delete achievementResult;
     }
 
@@ -2309,6 +2317,7 @@ void AchievementMgr::CompletedAchievement(AchievementEntry const* achievement)
     CompletedAchievementData& ca =  m_completedAchievements[achievement->ID];
     ca.date = time(nullptr);
     ca.changed = true;
+    m_completedAchievementsDataValid = false;
 
     // don't insert for ACHIEVEMENT_FLAG_REALM_FIRST_KILL since otherwise only the first group member would reach that achievement
     // TODO: where do set this instead?
@@ -2386,6 +2395,7 @@ void AchievementMgr::IncompletedAchievement(AchievementEntry const* achievement)
                                    GetPlayer()->GetGUIDLow(), achievement->ID);
 
     m_completedAchievements.erase(achievement->ID);
+    m_completedAchievementsDataValid = false;
 
     // reward items and titles if any
     AchievementReward const* reward = sAchievementMgr.GetAchievementReward(achievement, GetPlayer()->getGender());
@@ -2426,12 +2436,20 @@ void AchievementMgr::SendRespondInspectAchievements(Player* player)
  */
 void AchievementMgr::BuildAllDataPacket(WorldPacket& data)
 {
-    for (CompletedAchievementMap::const_iterator iter = m_completedAchievements.begin(); iter != m_completedAchievements.end(); ++iter)
+    // sent at every login, far teleport and inspect, but only changes when an achievement is gained or lost
+    if (!m_completedAchievementsDataValid)
     {
-        data << uint32(iter->first);
-        data << uint32(secsToTimeBitFields(iter->second.date));
+        m_completedAchievementsData.clear();
+        m_completedAchievementsData.reserve(m_completedAchievements.size() * 4 * 2 + 4);
+        for (CompletedAchievementMap::const_iterator iter = m_completedAchievements.begin(); iter != m_completedAchievements.end(); ++iter)
+        {
+            m_completedAchievementsData << uint32(iter->first);
+            m_completedAchievementsData << uint32(secsToTimeBitFields(iter->second.date));
+        }
+        m_completedAchievementsData << int32(-1);
+        m_completedAchievementsDataValid = true;
     }
-    data << int32(-1);
+    data.append(m_completedAchievementsData);
 
     time_t now = time(nullptr);
     for (CriteriaProgressMap::const_iterator iter = m_criteriaProgress.begin(); iter != m_criteriaProgress.end(); ++iter)
@@ -317,6 +317,10 @@ class AchievementMgr
         CriteriaProgressMap m_criteriaProgress;
         CompletedAchievementMap m_completedAchievements;
         AchievementCriteriaFailTimeMap m_criteriaFailTimes;
+
+        // serialized completed achievements block of BuildAllDataPacket, only changes when achievements are gained or lost
+        ByteBuffer m_completedAchievementsData;
+        bool m_completedAchievementsDataValid;
 };
 
 class AchievementGlobalMgr
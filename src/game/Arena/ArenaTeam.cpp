@@ -59,6 +59,9 @@ ArenaTeam::ArenaTeam()
 
     m_stats.wins_week     = 0;
     m_stats.wins_season   = 0;
+
+    m_rosterChanged       = true;
+    m_statsChanged        = true;
 }
 
 ArenaTeam::~ArenaTeam()
@@ -172,6 +175,7 @@ bool ArenaTeam::AddMember(ObjectGuid playerGuid)
         newmember.personal_rating = uint32(conf_value);
 
     m_members.push_back(newmember);
+    SetRosterChanged();
 
     CharacterDatabase.PExecute("INSERT INTO arena_team_member (arenateamid, guid, personal_rating) VALUES ('%u', '%u', '%u')", m_TeamId, newmember.guid.GetCounter(), newmember.personal_rating);
 
@@ -215,6 +219,7 @@ bool ArenaTeam::LoadArenaTeamFromDB(QueryResult* arenaTeamDataResult)
     m_stats.games_season = fields[12].GetUInt32();
     m_stats.wins_season  = fields[13].GetUInt32();
     m_stats.rank         = fields[14].GetUInt32();
+    SetRosterChanged();
 
     return true;
 }
@@ -274,6 +279,8 @@ bool ArenaTeam::LoadMembersFromDB(QueryResult* arenaTeamMembersResult)
     }
     while (arenaTeamMembersResult->NextRow());
 
+    SetRosterChanged();
+
     if (Empty() || !captainPresentInTeam)
     {
         // arena team is empty or captain is not in team, delete from db
@@ -293,6 +300,7 @@ void ArenaTeam::SetCaptain(ObjectGuid guid)
 
     // set new captain
     m_CaptainGuid = guid;
+    SetRosterChanged();
 
     // update database
     CharacterDatabase.PExecute("UPDATE arena_team SET captainguid = '%u' WHERE arenateamid = '%u'", guid.GetCounter(), m_TeamId);
@@ -309,6 +317,7 @@ void ArenaTeam::DelMember(ObjectGuid guid)
         if (itr->guid == guid)
         {
             m_members.erase(itr);
+            SetRosterChanged();
             break;
         }
     }
@@ -347,25 +356,29 @@ void ArenaTeam::Disband(WorldSession* session)
     sObjectMgr.RemoveArenaTeam(m_TeamId);
 }
 
-void ArenaTeam::Roster(WorldSession* session)
+void ArenaTeam::BuildRosterPacket()
 {
     uint8 unk308 = 0;
 
-    WorldPacket data(SMSG_ARENA_TEAM_ROSTER, 100);
-    data << uint32(GetId());                                // team id
-    data << uint8(unk308);                                  // 308 unknown value but affect packet structure
-    data << uint32(GetMembersSize());                       // members count
-    data << uint32(GetType());                              // arena team type?
+    m_rosterPacket.Initialize(SMSG_ARENA_TEAM_ROSTER, 100);
+    m_rosterPacket << uint32(GetId());                      // team id
+    m_rosterPacket << uint8(unk308);                        // 308 unknown value but affect packet structure
+    m_rosterPacket << uint32(GetMembersSize());             // members count
+    m_rosterPacket << uint32(GetType());                    // arena team type?
+
+    m_rosterPlayerPos.clear();
+    m_rosterPlayerPos.reserve(GetMembersSize());
 
+    WorldPacket& data = m_rosterPacket;
     for (MemberList::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
     {
-        Player* pl = sObjectMgr.GetPlayer(itr->guid);
-
         data << itr->guid;                                  // guid
-        data << uint8((pl ? 1 : 0));                        // online flag
+        size_t onlinePos = data.wpos();
+        data << uint8(0);                                   // online flag, set at send
         data << itr->name;                                  // member name
         data << uint32((itr->guid == GetCaptainGuid() ? 0 : 1));// captain flag 0 captain 1 member
-        data << uint8((pl ? pl->GetLevel() : 0));           // unknown, level?
+        m_rosterPlayerPos.emplace_back(onlinePos, data.wpos());
+        data << uint8(0);                                   // unknown, level? set at send
         data << uint8(itr->Class);                          // class
         data << uint32(itr->games_week);                    // played this week
         data << uint32(itr->wins_week);                     // wins this week
@@ -379,7 +392,26 @@ void ArenaTeam::Roster(WorldSession* session)
         }
     }
 
-    session->SendPacket(data);
+    m_rosterChanged = false;
+}
+
+void ArenaTeam::Roster(WorldSession* session)
+{
+    std::lock_guard<std::mutex> guard(m_packetMutex);
+
+    if (m_rosterChanged)
+        BuildRosterPacket();
+
+    // only online state and level are not tracked by the team
+    size_t i = 0;
+    for (MemberList::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr, ++i)
+    {
+        Player* pl = sObjectMgr.GetPlayer(itr->guid);
+        m_rosterPacket.put<uint8>(m_rosterPlayerPos[i].first, uint8(pl ? 1 : 0));
+        m_rosterPacket.put<uint8>(m_rosterPlayerPos[i].second, uint8(pl ? pl->GetLevel() : 0));
+    }
+
+    session->SendPacket(m_rosterPacket);
     DEBUG_LOG("WORLD: Sent SMSG_ARENA_TEAM_ROSTER");
 }
 
@@ -398,9 +430,9 @@ void ArenaTeam::Query(WorldSession* session) const
     DEBUG_LOG("WORLD: Sent SMSG_ARENA_TEAM_QUERY_RESPONSE");
 }
 
-void ArenaTeam::Stats(WorldSession* session) const
+void ArenaTeam::BuildStatsPacket(WorldPacket& data) const
 {
-    WorldPacket data(SMSG_ARENA_TEAM_STATS, 4 * 7);
+    data.Initialize(SMSG_ARENA_TEAM_STATS, 4 * 7);
     data << uint32(GetId());                                // team id
     data << uint32(m_stats.rating);                         // rating
     data << uint32(m_stats.games_week);                     // games this week
@@ -408,19 +440,29 @@ void ArenaTeam::Stats(WorldSession* session) const
     data << uint32(m_stats.games_season);                   // played this season
     data << uint32(m_stats.wins_season);                    // wins this season
     data << uint32(m_stats.rank);                           // rank
-    session->SendPacket(data);
+}
+
+void ArenaTeam::Stats(WorldSession* session) const
+{
+    std::lock_guard<std::mutex> guard(m_packetMutex);
+
+    if (m_statsChanged)
+    {
+        BuildStatsPacket(m_statsPacket);
+        m_statsChanged = false;
+    }
+
+    session->SendPacket(m_statsPacket);
 }
 
 void ArenaTeam::NotifyStatsChanged()
 {
     // this is called after a rated match ended
     // updates arena team stats for every member of the team (not only the ones who participated!)
-    for (MemberList::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
-    {
-        Player* plr = sObjectMgr.GetPlayer(itr->guid);
-        if (plr)
-            Stats(plr->GetSession());
-    }
+    // built locally, the cached packet belongs to Stats() on the world thread
+    WorldPacket data;
+    BuildStatsPacket(data);
+    BroadcastPacket(data);
 }
 
 void ArenaTeam::InspectStats(WorldSession* session, ObjectGuid guid)
@@ -454,6 +496,8 @@ void ArenaTeam::SetEmblem(uint32 backgroundColor, uint32 emblemStyle, uint32 emb
 
 void ArenaTeam::SetStats(uint32 stat_type, uint32 value)
 {
+    SetRosterChanged();
+
     switch (stat_type)
     {
         case STAT_TYPE_RATING:
@@ -540,6 +584,15 @@ uint8 ArenaTeam::GetSlotByType(ArenaType type)
     return 0xFF;
 }
 
+void ArenaTeam::SetMemberName(ObjectGuid guid, std::string const& name)
+{
+    if (ArenaTeamMember* member = GetMember(guid))
+    {
+        member->name = name;
+        SetRosterChanged();
+    }
+}
+
 bool ArenaTeam::HaveMember(ObjectGuid guid) const
 {
     for (const auto& m_member : m_members)
@@ -596,6 +649,7 @@ void ArenaTeam::FinishGame(int32 mod)
 
     m_stats.games_week += 1;
     m_stats.games_season += 1;
+    SetRosterChanged();
     // update team's rank
     m_stats.rank = 1;
     ObjectMgr::ArenaTeamMap::const_iterator i = sObjectMgr.GetArenaTeamMapBegin();
@@ -654,6 +708,7 @@ void ArenaTeam::MemberLost(Player* plr, uint32 againstRating)
             // update personal played stats
             m_member.games_week += 1;
             m_member.games_season += 1;
+            SetRosterChanged();
             // update the unit fields
             plr->SetArenaTeamInfoField(GetSlot(), ARENA_TEAM_GAMES_WEEK, m_member.games_week);
             plr->SetArenaTeamInfoField(GetSlot(), ARENA_TEAM_GAMES_SEASON, m_member.games_season);
@@ -681,6 +736,7 @@ void ArenaTeam::OfflineMemberLost(ObjectGuid guid, uint32 againstRating)
             // update personal played stats
             m_member.games_week += 1;
             m_member.games_season += 1;
+            SetRosterChanged();
             return;
         }
     }
@@ -702,6 +758,7 @@ void ArenaTeam::MemberWon(Player* plr, uint32 againstRating)
             // update personal stats
             m_member.games_week += 1;
             m_member.games_season += 1;
+            SetRosterChanged();
             m_member.wins_season += 1;
             m_member.wins_week += 1;
             // update unit fields
@@ -745,11 +802,32 @@ void ArenaTeam::SaveToDB()
 {
     // save team and member stats to db
     // called after a match has ended, or when calculating arena_points
+    // members are only updated, a member removed meanwhile on another thread must not be inserted again
+    static SqlStatementID updArenaTeamStats;
+    static SqlStatementID updArenaTeamMember;
+
     CharacterDatabase.BeginTransaction();
-    CharacterDatabase.PExecute("UPDATE arena_team_stats SET rating = '%u',games_week = '%u',games_season = '%u',`rank` = '%u',wins_week = '%u',wins_season = '%u' WHERE arenateamid = '%u'", m_stats.rating, m_stats.games_week, m_stats.games_season, m_stats.rank, m_stats.wins_week, m_stats.wins_season, GetId());
+    SqlStatement stmt = CharacterDatabase.CreateStatement(updArenaTeamStats, "UPDATE arena_team_stats SET rating = ?, games_week = ?, games_season = ?, `rank` = ?, wins_week = ?, wins_season = ? WHERE arenateamid = ?");
+    stmt.addUInt32(m_stats.rating);
+    stmt.addUInt32(m_stats.games_week);
+    stmt.addUInt32(m_stats.games_season);
+    stmt.addUInt32(m_stats.rank);
+    stmt.addUInt32(m_stats.wins_week);
+    stmt.addUInt32(m_stats.wins_season);
+    stmt.addUInt32(GetId());
+    stmt.Execute();
+
     for (MemberList::const_iterator itr = m_members.begin(); itr !=  m_members.end(); ++itr)
     {
-        CharacterDatabase.PExecute("UPDATE arena_team_member SET played_week = '%u', wons_week = '%u', played_season = '%u', wons_season = '%u', personal_rating = '%u' WHERE arenateamid = '%u' AND guid = '%u'", itr->games_week, itr->wins_week, itr->games_season, itr->wins_season, itr->personal_rating, m_TeamId, itr->guid.GetCounter());
+        stmt = CharacterDatabase.CreateStatement(updArenaTeamMember, "UPDATE arena_team_member SET played_week = ?, wons_week = ?, played_season = ?, wons_season = ?, personal_rating = ? WHERE arenateamid = ? AND guid = ?");
+        stmt.addUInt32(itr->games_week);
+        stmt.addUInt32(itr->wins_week);
+        stmt.addUInt32(itr->games_season);
+        stmt.addUInt32(itr->wins_season);
+        stmt.addUInt32(itr->personal_rating);
+        stmt.addUInt32(m_TeamId);
+        stmt.addUInt32(itr->guid.GetCounter());
+        stmt.Execute();
     }
     CharacterDatabase.CommitTransaction();
 }
@@ -758,6 +836,7 @@ void ArenaTeam::FinishWeek()
 {
     m_stats.games_week = 0;                                 // played this week
     m_stats.wins_week = 0;                                  // wins this week
+    SetRosterChanged();
     for (auto& m_member : m_members)
     {
         m_member.games_week = 0;
@@ -786,6 +865,7 @@ void ArenaTeam::FinishSeason()
     m_stats.rating = 0;
     m_stats.games_week = 0;
     m_stats.wins_week = 0;
+    SetRosterChanged();
     for (MemberList::iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
     {
         itr->games_week = 0;
@@ -799,6 +879,7 @@ void ArenaTeam::FinishSeason()
 void ArenaTeam::SetRatingForAll(uint32 rating)
 {
     m_stats.rating = rating;
+    SetRosterChanged();
     for (auto& memberData : m_members)
         memberData.personal_rating = rating;
 }
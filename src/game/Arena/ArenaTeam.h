@@ -22,9 +22,11 @@
 #include "Common.h"
 #include "Entities/ObjectGuid.h"
 #include "Globals/SharedDefines.h"
+#include "WorldPacket.h"
+
+#include <mutex>
 
 class QueryResult;
-class WorldPacket;
 class WorldSession;
 class Player;
 
@@ -151,6 +153,7 @@ class ArenaTeam
         bool   Empty() const                  { return m_members.empty(); }
         MemberList& GetMembers()              { return m_members; }
         bool HaveMember(ObjectGuid guid) const;
+        void SetMemberName(ObjectGuid guid, std::string const& name);
 
         ArenaTeamMember* GetMember(ObjectGuid guid)
         {
@@ -225,5 +228,24 @@ class ArenaTeam
 
         MemberList m_members;
         ArenaTeamStats m_stats;
+
+    private:
+        // roster and stats packets are kept serialized and rebuilt only after a change
+        void SetRosterChanged()
+        {
+            std::lock_guard<std::mutex> guard(m_packetMutex);
+            m_rosterChanged = true;
+            m_statsChanged = true;
+        }
+        void BuildRosterPacket();
+        void BuildStatsPacket(WorldPacket& data) const;
+
+        // team is changed from battleground map threads and queried from the world thread
+        mutable std::mutex m_packetMutex;
+        WorldPacket m_rosterPacket;
+        std::vector<std::pair<size_t, size_t> > m_rosterPlayerPos; // per member positions of online flag and level, patched at send
+        bool m_rosterChanged;
+        mutable WorldPacket m_statsPacket;
+        mutable bool m_statsChanged;
 };
 #endif
@@ -728,6 +728,10 @@ bool ChatHandler::HandleReloadSpellChainCommand(char* /*args*/)
     sLog.outString("Re-Loading Spell Chain Data... ");
     sSpellMgr.LoadSpellChains();
     SendGlobalSysMessage("DB table `spell_chain` (spell ranks) reloaded.");
+
+    // trainer list rows contain first rank and required spell data from the chains
+    sLog.outString("Re-Building trainer spell list rows...");
+    sObjectMgr.RebuildTrainerPacketRows();
     return true;
 }
 
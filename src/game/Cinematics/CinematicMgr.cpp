@@ -19,6 +19,9 @@
 #include "CinematicMgr.h"
 #include "Entities/Player.h"
 
+// pre-sampled camera object positions, indexed by cinematic time / CINEMATIC_SAMPLE_STEP
+static std::unordered_map<uint32, std::vector<Position>> sCameraSampleStore;
+
 CinematicMgr::CinematicMgr(Player* playerref)
 {
     player = playerref;
@@ -27,8 +30,10 @@ CinematicMgr::CinematicMgr(Player* playerref)
     m_activeCinematicCameraId = 0;
     m_cinematicLength = 0;
     m_cinematicCamera = nullptr;
+    m_cinematicSamples = nullptr;
     m_remoteSightPosition = { 0.0f, 0.0f, 0.0f, 0.0f};
     m_CinematicObject = nullptr;
+    m_cinematicMap = nullptr;
 }
 
 CinematicMgr::~CinematicMgr()
@@ -50,6 +55,9 @@ void CinematicMgr::BeginCinematic()
         m_cinematicDiff = 0;
         m_cinematicCamera = &itr->second;
 
+        auto sampleItr = sCameraSampleStore.find(m_activeCinematicCameraId);
+        m_cinematicSamples = sampleItr != sCameraSampleStore.end() ? &sampleItr->second : nullptr;
+
         auto camitr = m_cinematicCamera->begin();
         if (camitr != m_cinematicCamera->end())
         {
@@ -58,10 +66,11 @@ void CinematicMgr::BeginCinematic()
                 return;
 
             player->GetMap()->ForceLoadGrid(camitr->locations.x, camitr->locations.y);
-            m_CinematicObject = player->SummonCreature(VISUAL_WAYPOINT, pos.x, pos.y, pos.z, 0.0f, TEMPSPAWN_TIMED_DESPAWN, 5 * MINUTE * IN_MILLISECONDS);
+            // players starting this cinematic in the same update step share the camera object and its visibility updates
+            m_CinematicObject = player->GetMap()->AcquireCinematicObject(player, m_activeCinematicCameraId, pos);
             if (m_CinematicObject)
             {
-                m_CinematicObject->SetActiveObjectState(true);
+                m_cinematicMap = player->GetMap();
                 player->GetCamera().SetView(m_CinematicObject, true);
             }
 
@@ -82,6 +91,7 @@ void CinematicMgr::EndCinematic()
 
     m_cinematicDiff = 0;
     m_cinematicCamera = nullptr;
+    m_cinematicSamples = nullptr;
     m_activeCinematicCameraId = 0;
     if (m_CinematicObject)
     {
@@ -89,7 +99,13 @@ void CinematicMgr::EndCinematic()
             if (vpObject == m_CinematicObject)
                 player->GetCamera().ResetView();
 
-        m_CinematicObject->AddObjectToRemoveList();
+        // can be called outside of the owning map update (logout, map change), release through its messager
+        m_cinematicMap->GetMessager().AddMessage([guid = m_CinematicObject->GetObjectGuid()](Map* map)
+        {
+            map->ReleaseCinematicObject(guid);
+        });
+        m_CinematicObject = nullptr;
+        m_cinematicMap = nullptr;
     }
 }
 
@@ -106,19 +122,42 @@ bool CinematicMgr::UpdateCinematicLocation(uint32 /*diff*/)
         return false;
     }
 
+    // camera object stayed on the previous map
+    if (m_CinematicObject && player->GetMap() != m_cinematicMap)
+    {
+        EndCinematic();
+        return false;
+    }
+
     // just created and waiting BeginCinematic call
-    if (!m_cinematicCamera || m_cinematicCamera->size() == 0)
+    if (!m_cinematicCamera || !m_cinematicSamples || m_cinematicSamples->empty())
+        return true;
+
+    // The remote sight object is used to send update information to player in cinematic.
+    // Its step is counted from the start shared by all its viewers, so it is moved once per step
+    uint32 step;
+    if (!m_CinematicObject || !m_cinematicMap->AdvanceCinematicObject(m_CinematicObject, uint32(m_cinematicSamples->size() - 1), step))
         return true;
 
+    // Advance (at speed) to this position
+    Position const& interPosition = (*m_cinematicSamples)[step];
+    if (MaNGOS::IsValidMapCoord(interPosition.x, interPosition.y, interPosition.z, interPosition.o))
+        m_CinematicObject->MonsterMoveWithSpeed(interPosition.x, interPosition.y, interPosition.z, 500.0f, false, true);
+
+    return true;
+}
+
+bool CinematicMgr::CalculateCameraPosition(FlyByCameraCollection const& camera, uint32 cinematicDiff, Position& pos)
+{
     Position lastPosition;
     uint32 lastTimestamp = 0;
     Position nextPosition;
     uint32 nextTimestamp = 0;
 
     // Obtain direction of travel
-    for (FlyByCamera cam : *m_cinematicCamera)
+    for (FlyByCamera cam : camera)
     {
-        if (cam.timeStamp > m_cinematicDiff)
+        if (cam.timeStamp > cinematicDiff)
         {
             nextPosition = { cam.locations.x, cam.locations.y, cam.locations.z, cam.locations.w };
             nextTimestamp = cam.timeStamp;
@@ -139,22 +178,22 @@ bool CinematicMgr::UpdateCinematicLocation(uint32 /*diff*/)
         angle += 2 * float(M_PI);
 
     // Look for position around 2 second ahead of us.
-    int32 workDiff = m_cinematicDiff;
+    int32 workDiff = cinematicDiff;
 
     // Modify result based on camera direction (Humans for example, have the camera point behind)
     workDiff += static_cast<int32>(float(CINEMATIC_LOOKAHEAD) * cos(angle));
 
     // Get an iterator to the last entry in the cameras, to make sure we don't go beyond the end
-    FlyByCameraCollection::const_reverse_iterator endItr = m_cinematicCamera->rbegin();
-    if (endItr != m_cinematicCamera->rend() && workDiff > static_cast<int32>(endItr->timeStamp))
+    FlyByCameraCollection::const_reverse_iterator endItr = camera.rbegin();
+    if (endItr != camera.rend() && workDiff > static_cast<int32>(endItr->timeStamp))
         workDiff = endItr->timeStamp;
 
     // Never try to go back in time before the start of cinematic!
     if (workDiff < 0)
-        workDiff = m_cinematicDiff;
+        workDiff = cinematicDiff;
 
     // Obtain the previous and next waypoint based on timestamp
-    for (FlyByCamera cam : *m_cinematicCamera)
+    for (FlyByCamera cam : camera)
     {
         if (static_cast<int32>(cam.timeStamp) >= workDiff)
         {
@@ -172,17 +211,35 @@ bool CinematicMgr::UpdateCinematicLocation(uint32 /*diff*/)
 
     // Interpolate the position for this moment in time (or the adjusted moment in time)
     uint32 timeDiff = nextTimestamp - lastTimestamp;
+    if (!timeDiff)
+        return false;
+
     uint32 interDiff = workDiff - lastTimestamp;
     float xDiff = nextPosition.x - lastPosition.x;
     float yDiff = nextPosition.y - lastPosition.y;
     float zDiff = nextPosition.z - lastPosition.z;
-    Position interPosition = { lastPosition.x + (xDiff * (float(interDiff) / float(timeDiff))), lastPosition.y +
+    pos = { lastPosition.x + (xDiff * (float(interDiff) / float(timeDiff))), lastPosition.y +
         (yDiff * (float(interDiff) / float(timeDiff))), lastPosition.z + (zDiff * (float(interDiff) / float(timeDiff))), 0.0f };
 
-    // Advance (at speed) to this position. The remote sight object is used
-    // to send update information to player in cinematic
-    if (m_CinematicObject && MaNGOS::IsValidMapCoord(interPosition.x, interPosition.y, interPosition.z, interPosition.o))
-        m_CinematicObject->MonsterMoveWithSpeed(interPosition.x, interPosition.y, interPosition.z, 500.0f, false, true);
+    return MaNGOS::IsValidMapCoord(pos.x, pos.y, pos.z, pos.o);
+}
 
-    return true;
+void CinematicMgr::LoadCameraSamples()
+{
+    sCameraSampleStore.clear();
+
+    for (auto const& itr : sFlyByCameraStore)
+    {
+        FlyByCameraCollection const& camera = itr.second;
+        if (camera.empty())
+            continue;
+
+        // invalid positions are stored as NaN and skipped at update
+        std::vector<Position>& samples = sCameraSampleStore[itr.first];
+        uint32 length = camera.back().timeStamp;
+        samples.resize(length / CINEMATIC_SAMPLE_STEP + 1);
+        for (size_t i = 0; i < samples.size(); ++i)
+            if (!CalculateCameraPosition(camera, uint32(i * CINEMATIC_SAMPLE_STEP), samples[i]))
+                samples[i].x = std::numeric_limits<float>::quiet_NaN();
+    }
 }
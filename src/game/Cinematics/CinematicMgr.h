@@ -24,6 +24,7 @@
 
 #define CINEMATIC_LOOKAHEAD (2 * IN_MILLISECONDS)
 #define CINEMATIC_UPDATEDIFF 200
+#define CINEMATIC_SAMPLE_STEP 100                           // resolution of the pre-sampled camera positions
 
 class Player;
 class CinematicMgr;
@@ -45,7 +46,12 @@ public:
     void EndCinematic();
     bool UpdateCinematicLocation(uint32 diff);
 
+    // Camera object positions only depend on the camera and elapsed time, so they are sampled once after loading the cameras
+    static void LoadCameraSamples();
+
 private:
+    static bool CalculateCameraPosition(FlyByCameraCollection const& camera, uint32 cinematicDiff, Position& pos);
+
     // Remote location information
     Player*     player;
 
@@ -55,8 +61,10 @@ protected:
     uint32      m_activeCinematicCameraId;
     uint32      m_cinematicLength;
     FlyByCameraCollection* m_cinematicCamera;
+    std::vector<Position> const* m_cinematicSamples;
     Position    m_remoteSightPosition;
     Creature*   m_CinematicObject;
+    Map*        m_cinematicMap;                             // map owning m_CinematicObject
 };
 
 #endif
@@ -28,6 +28,7 @@
 #include "Entities/Player.h"
 #include "Guilds/Guild.h"
 #include "Guilds/GuildMgr.h"
+#include "Arena/ArenaTeam.h"
 #include "Globals/ObjectAccessor.h"
 #include "Groups/Group.h"
 #include "Database/DatabaseImpl.h"
@@ -991,6 +992,7 @@ void WorldSession::HandlePlayerReconnect()
             object->RemoveClientIAmAt(_player);
     }
     _player->m_clientGUIDs.clear();
+    _player->m_clientQuestGUIDs.clear();
 
     m_initialZoneUpdated = false;
 
@@ -1271,6 +1273,18 @@ void WorldSession::HandleChangePlayerNameOpcodeCallBack(QueryResult* result, uin
     data << newname;
     session->SendPacket(data);
 
+    // arena team rosters keep member names, only the teams of this character need it
+    if (QueryResult* teams = CharacterDatabase.PQuery("SELECT arenateamid FROM arena_team_member WHERE guid = '%u'", guidLow))
+    {
+        do
+        {
+            if (ArenaTeam* team = sObjectMgr.GetArenaTeamById(teams->Fetch()[0].GetUInt32()))
+                team->SetMemberName(guid, newname);
+        }
+        while (teams->NextRow());
+        delete teams;
+    }
+
     sWorld.InvalidatePlayerDataToAllClient(guid);
 }
 
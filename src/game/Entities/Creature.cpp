@@ -70,6 +70,51 @@ TrainerSpell const* TrainerSpellData::Find(uint32 spell_id) const
     return nullptr;
 }
 
+void TrainerSpell::BuildPacketRow()
+{
+    bool primary_prof_first_rank = sSpellMgr.IsPrimaryProfessionFirstRankSpell(learnedSpell);
+    SpellChainNode const* chain_node = sSpellMgr.GetSpellChainNode(learnedSpell);
+
+    ByteBuffer row(TRAINER_SPELL_ROW_SIZE);
+    row << uint32(spell);                                   // learned spell (or cast-spell in profession case)
+    row << uint8(0);                                        // state, patched
+    row << uint32(spellCost);                               // cost, patched with reputation discount
+    row << uint32(0);                                       // spells don't cost talent points
+    row << uint32(primary_prof_first_rank ? 1 : 0);         // must be equal prev. field to have learn button in enabled state
+    row << uint8(0);                                        // required level, patched
+    row << uint32(reqSkill);
+    row << uint32(reqSkillValue);
+    row << uint32(!IsCastable() && chain_node ? (chain_node->prev ? chain_node->prev : chain_node->req) : 0);
+    row << uint32(!IsCastable() && chain_node && chain_node->prev ? chain_node->req : 0);
+    row << uint32(0);
+
+    MANGOS_ASSERT(row.size() == TRAINER_SPELL_ROW_SIZE);
+    memcpy(packetRow, row.contents(), TRAINER_SPELL_ROW_SIZE);
+}
+
+void VendorItem::BuildPacketRow()
+{
+    ItemPrototype const* pProto = ObjectMgr::GetItemPrototype(item);
+    if (!pProto)
+    {
+        memset(packetRow, 0, VENDOR_ITEM_ROW_SIZE);
+        return;
+    }
+
+    ByteBuffer row(VENDOR_ITEM_ROW_SIZE);
+    row << uint32(0);                                       // vendor slot, patched
+    row << uint32(pProto->ItemId);
+    row << uint32(pProto->DisplayInfoID);
+    row << uint32(0xFFFFFFFF);                              // stock count, patched for limited items
+    row << uint32(0);                                       // price, patched with reputation discount
+    row << uint32(pProto->MaxDurability);
+    row << uint32(pProto->BuyCount);
+    row << uint32(ExtendedCost);
+
+    MANGOS_ASSERT(row.size() == VENDOR_ITEM_ROW_SIZE);
+    memcpy(packetRow, row.contents(), VENDOR_ITEM_ROW_SIZE);
+}
+
 bool VendorItemData::RemoveItem(uint32 item_id)
 {
     bool found = false;
@@ -250,6 +295,9 @@ void Creature::RemoveFromWorld()
             GetMap()->RemoveFromSpawnCount(GetObjectGuid());
 
         ClearCreatureGroup();
+
+        if (sCreatureLinkingMgr.GetLinkedTriggerInformation(this))
+            GetMap()->GetCreatureLinkingHolder()->RemoveSlaveFromHolder(this);
     }
 
     Unit::RemoveFromWorld();
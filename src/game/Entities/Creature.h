@@ -390,16 +390,28 @@ enum RegenStatsFlags
 };
 
 // Vendors
+// item entry of SMSG_LIST_INVENTORY: slot, item, display, stock count, price, durability, buy count, extended cost
+#define VENDOR_ITEM_ROW_SIZE            (8 * 4)
+#define VENDOR_ITEM_ROW_SLOT_OFFSET     0
+#define VENDOR_ITEM_ROW_COUNT_OFFSET    12
+#define VENDOR_ITEM_ROW_PRICE_OFFSET    16
+
 struct VendorItem
 {
     VendorItem(uint32 _item, uint32 _maxcount, uint32 _incrtime, uint32 _ExtendedCost, uint16 _conditionId)
-        : item(_item), maxcount(_maxcount), incrtime(_incrtime), ExtendedCost(_ExtendedCost), conditionId(_conditionId) {}
+        : item(_item), maxcount(_maxcount), incrtime(_incrtime), ExtendedCost(_ExtendedCost), conditionId(_conditionId) { BuildPacketRow(); }
 
     uint32 item;
     uint32 maxcount;                                        // 0 for infinity item amount
     uint32 incrtime;                                        // time for restore items amount if maxcount != 0
     uint32 ExtendedCost;                                    // index in ItemExtendedCost.dbc
     uint16 conditionId;                                     // condition to check for this item
+
+    // prebuilt packet entry, slot, stock count and price are player/creature dependent and patched at send
+    uint8 packetRow[VENDOR_ITEM_ROW_SIZE];
+
+    private:
+        void BuildPacketRow();
 };
 typedef std::vector<VendorItem*> VendorItemList;
 
@@ -441,13 +453,19 @@ struct VendorItemCount
 
 typedef std::list<VendorItemCount> VendorItemCounts;
 
+// spell entry of SMSG_TRAINER_LIST: spell, state, cost, talent cost, first rank, req level, req skill, req skill value, 2x req spell, unk
+#define TRAINER_SPELL_ROW_SIZE          (4 + 1 + 4 + 4 + 4 + 1 + 4 + 4 + 4 + 4 + 4)
+#define TRAINER_SPELL_ROW_STATE_OFFSET  4
+#define TRAINER_SPELL_ROW_COST_OFFSET   5
+#define TRAINER_SPELL_ROW_LEVEL_OFFSET  17
+
 struct TrainerSpell
 {
 #ifdef BUILD_PLAYERBOT
-    TrainerSpell() : spell(0), spellCost(0), reqSkill(0), reqSkillValue(0), reqLevel(0), learnedSpell(0), isProvidedReqLevel(false), conditionId(0) {}
+    TrainerSpell() : spell(0), spellCost(0), reqSkill(0), reqSkillValue(0), reqLevel(0), learnedSpell(0), isProvidedReqLevel(false), conditionId(0), packetRow() {}
 
     TrainerSpell(uint32 _spell, uint32 _spellCost, uint32 _reqSkill, uint32 _reqSkillValue, uint32 _reqLevel, uint32 _learnedspell, bool _isProvidedReqLevel, uint32 _conditionId)
-        : spell(_spell), spellCost(_spellCost), reqSkill(_reqSkill), reqSkillValue(_reqSkillValue), reqLevel(_reqLevel), learnedSpell(_learnedspell), isProvidedReqLevel(_isProvidedReqLevel), conditionId(_conditionId) {}
+        : spell(_spell), spellCost(_spellCost), reqSkill(_reqSkill), reqSkillValue(_reqSkillValue), reqLevel(_reqLevel), learnedSpell(_learnedspell), isProvidedReqLevel(_isProvidedReqLevel), conditionId(_conditionId), packetRow() {}
 
     uint32 spell;
     uint32 spellCost;
@@ -458,13 +476,18 @@ struct TrainerSpell
     uint32 conditionId;
     bool isProvidedReqLevel;
 
+    // prebuilt packet entry, state, cost and required level are player dependent and patched at send
+    uint8 packetRow[TRAINER_SPELL_ROW_SIZE];
+
     // helpers
     bool IsCastable() const { return learnedSpell != spell; }
+    // must be called after learnedSpell is final, requires loaded spell chains
+    void BuildPacketRow();
 #else
-    TrainerSpell() : spell(0), spellCost(0), reqSkill(0), reqSkillValue(0), reqLevel(0), learnedSpell(0), conditionId(0), isProvidedReqLevel(false) {}
+    TrainerSpell() : spell(0), spellCost(0), reqSkill(0), reqSkillValue(0), reqLevel(0), learnedSpell(0), conditionId(0), isProvidedReqLevel(false), packetRow() {}
 
     TrainerSpell(uint32 _spell, uint32 _spellCost, uint32 _reqSkill, uint32 _reqSkillValue, uint32 _reqLevel, uint32 _learnedspell, bool _isProvidedReqLevel, uint32 _conditionId)
-        : spell(_spell), spellCost(_spellCost), reqSkill(_reqSkill), reqSkillValue(_reqSkillValue), reqLevel(_reqLevel), learnedSpell(_learnedspell), conditionId(_conditionId), isProvidedReqLevel(_isProvidedReqLevel) {}
+        : spell(_spell), spellCost(_spellCost), reqSkill(_reqSkill), reqSkillValue(_reqSkillValue), reqLevel(_reqLevel), learnedSpell(_learnedspell), conditionId(_conditionId), isProvidedReqLevel(_isProvidedReqLevel), packetRow() {}
 
     uint32 spell;
     uint32 spellCost;
@@ -475,8 +498,13 @@ struct TrainerSpell
     uint32 conditionId;
     bool isProvidedReqLevel;
 
+    // prebuilt packet entry, state, cost and required level are player dependent and patched at send
+    uint8 packetRow[TRAINER_SPELL_ROW_SIZE];
+
     // helpers
     bool IsCastable() const { return learnedSpell != spell; }
+    // must be called after learnedSpell is final, requires loaded spell chains
+    void BuildPacketRow();
 #endif
 };
 
@@ -344,7 +344,7 @@ void CreatureLinkingHolder::AddSlaveToHolder(Creature* pCreature)
         {
             if (itr->second.linkingFlag == pInfo->linkingFlag)
             {
-                itr->second.linkedGuids.push_back(std::make_pair(pCreature->GetDbGuid(), pCreature->GetObjectGuid()));
+                AddSlaveToList(itr->second.linkedSlaves, pCreature);
                 pCreature = nullptr;                           // Store that is was handled
                 break;
             }
@@ -354,7 +354,7 @@ void CreatureLinkingHolder::AddSlaveToHolder(Creature* pCreature)
         if (pCreature)
         {
             InfoAndGuids tmp;
-            tmp.linkedGuids.push_back(std::make_pair(pCreature->GetDbGuid(), pCreature->GetObjectGuid()));
+            AddSlaveToList(tmp.linkedSlaves, pCreature);
             tmp.linkingFlag = pInfo->linkingFlag;
             tmp.searchRange = 0;
             m_holderGuidMap.insert(HolderMap::value_type(pInfo->masterId, tmp));
@@ -368,7 +368,7 @@ void CreatureLinkingHolder::AddSlaveToHolder(Creature* pCreature)
     {
         if (itr->second.linkingFlag == pInfo->linkingFlag && itr->second.searchRange == pInfo->searchRange)
         {
-            itr->second.linkedGuids.push_back(std::make_pair(pCreature->GetDbGuid(), pCreature->GetObjectGuid()));
+            AddSlaveToList(itr->second.linkedSlaves, pCreature);
             pCreature = nullptr;                               // Store that is was handled
             break;
         }
@@ -378,13 +378,56 @@ void CreatureLinkingHolder::AddSlaveToHolder(Creature* pCreature)
     if (pCreature)
     {
         InfoAndGuids tmp;
-        tmp.linkedGuids.push_back(std::make_pair(pCreature->GetDbGuid(), pCreature->GetObjectGuid()));
+        AddSlaveToList(tmp.linkedSlaves, pCreature);
         tmp.linkingFlag = pInfo->linkingFlag;
         tmp.searchRange = pInfo->searchRange;
         m_holderMap.insert(HolderMap::value_type(pInfo->masterId, tmp));
     }
 }
 
+// Helper function to add a slave, a respawned spawn replaces its previous entry
+void CreatureLinkingHolder::AddSlaveToList(LinkedSlaveList& slaveList, Creature* pCreature)
+{
+    LinkedSlave* slave = nullptr;
+    if (uint32 dbGuid = pCreature->GetDbGuid())
+    {
+        for (auto& linkedSlave : slaveList)
+        {
+            if (linkedSlave.dbGuid == dbGuid)
+            {
+                slave = &linkedSlave;
+                break;
+            }
+        }
+    }
+
+    if (!slave)
+    {
+        slaveList.push_back(LinkedSlave());
+        slave = &slaveList.back();
+    }
+
+    slave->dbGuid = pCreature->GetDbGuid();
+    slave->guid = pCreature->GetObjectGuid();
+    slave->creature = pCreature;
+}
+
+// Function to drop the cached pointer of a slave-NPC leaving the map
+void CreatureLinkingHolder::RemoveSlaveFromHolder(Creature* pCreature)
+{
+    CreatureLinkingInfo const* pInfo = sCreatureLinkingMgr.GetLinkedTriggerInformation(pCreature);
+    if (!pInfo)
+        return;
+
+    // entries stay, they may be in processing and the spawn can still be resolved by its db guid
+    HolderMap& holderMap = pInfo->mapId == INVALID_MAP_ID ? m_holderGuidMap : m_holderMap;
+    HolderMapBounds bounds = holderMap.equal_range(pInfo->masterId);
+    for (HolderMap::iterator itr = bounds.first; itr != bounds.second; ++itr)
+        for (auto& linkedSlave : itr->second.linkedSlaves)
+            if (linkedSlave.creature == pCreature)
+                linkedSlave.creature = nullptr;
+}
+
 // Function to add master-NPCs to the holder
 void CreatureLinkingHolder::AddMasterToHolder(Creature* pCreature)
 {
@@ -437,7 +480,7 @@ void CreatureLinkingHolder::DoCreatureLinkingEvent(CreatureLinkingEvent eventTyp
         if (!itr->second.inUse)
         {
             itr->second.inUse = true;
-            ProcessSlaveGuidList(eventType, pSource, itr->second.linkingFlag & eventFlagFilter, itr->second.searchRange, itr->second.linkedGuids, pEnemy);
+            ProcessSlaveGuidList(eventType, pSource, itr->second.linkingFlag & eventFlagFilter, itr->second.searchRange, itr->second.linkedSlaves, pEnemy);
             itr->second.inUse = false;
         }
     }
@@ -449,7 +492,7 @@ void CreatureLinkingHolder::DoCreatureLinkingEvent(CreatureLinkingEvent eventTyp
         if (!itr->second.inUse)
         {
             itr->second.inUse = true;
-            ProcessSlaveGuidList(eventType, pSource, itr->second.linkingFlag & eventFlagFilter, itr->second.searchRange, itr->second.linkedGuids, pEnemy);
+            ProcessSlaveGuidList(eventType, pSource, itr->second.linkingFlag & eventFlagFilter, itr->second.searchRange, itr->second.linkedSlaves, pEnemy);
             itr->second.inUse = false;
         }
     }
@@ -518,7 +561,7 @@ void CreatureLinkingHolder::DoCreatureLinkingEvent(CreatureLinkingEvent eventTyp
 }
 
 // Helper function, to process a slave list
-void CreatureLinkingHolder::ProcessSlaveGuidList(CreatureLinkingEvent eventType, Creature* pSource, uint32 flag, uint16 searchRange, std::list<std::pair<uint32, ObjectGuid>>& slaveGuidList, Unit* pEnemy)
+void CreatureLinkingHolder::ProcessSlaveGuidList(CreatureLinkingEvent eventType, Creature* pSource, uint32 flag, uint16 searchRange, LinkedSlaveList& slaveList, Unit* pEnemy)
 {
     if (!flag)
         return;
@@ -531,23 +574,32 @@ void CreatureLinkingHolder::ProcessSlaveGuidList(CreatureLinkingEvent eventType,
         postprocessFlag = (postprocessFlag & ~(FLAG_RESPAWN_ON_EVADE | FLAG_RESPAWN_ON_DEATH | FLAG_RESPAWN_ON_RESPAWN));
     }
 
-    for (auto slave_itr = slaveGuidList.begin(); slave_itr != slaveGuidList.end();)
+    // Slaves may be added (respawn) or have their creature cleared while processing, so work by index
+    for (size_t i = 0; i < slaveList.size();)
     {
-        Creature* pSlave;
-        if ((*slave_itr).first)
-            pSlave = pSource->GetMap()->GetCreature((*slave_itr).first);
-        else
-            pSlave = pSource->GetMap()->GetCreature((*slave_itr).second);
+        Creature* pSlave = slaveList[i].creature;
+        if (!pSlave)
+        {
+            if (slaveList[i].dbGuid)
+                pSlave = pSource->GetMap()->GetCreature(slaveList[i].dbGuid);
+            else
+                pSlave = pSource->GetMap()->GetCreature(slaveList[i].guid);
+            slaveList[i].creature = pSlave;
+        }
         if ((!pSlave || pSlave->IsCorpse()) && preprocessFlag) // dynguid respawning
-            pSource->GetMap()->GetSpawnManager().RespawnCreature((*slave_itr).first);
+            pSource->GetMap()->GetSpawnManager().RespawnCreature(slaveList[i].dbGuid);
         if (!pSlave)
         {
-            // Remove old guid first
-            slave_itr = slaveGuidList.erase(slave_itr);
+            // Remove old guid first, order of slaves does not matter
+            if (!slaveList[i].creature)
+            {
+                slaveList[i] = slaveList.back();
+                slaveList.pop_back();
+            }
             continue;
         }
 
-        ++slave_itr;
+        ++i;
 
         // Ignore Pets
         if (pSlave->IsPet())
@@ -154,6 +154,9 @@ class CreatureLinkingHolder
         // Function to add master-NPCs to the holder
         void AddMasterToHolder(Creature* pCreature);
 
+        // Function to drop the cached pointer of a slave-NPC leaving the map
+        void RemoveSlaveFromHolder(Creature* pCreature);
+
         // Function to process actions for linked NPCs
         void DoCreatureLinkingEvent(CreatureLinkingEvent eventType, Creature* pSource, Unit* pEnemy = nullptr);
 
@@ -166,12 +169,21 @@ class CreatureLinkingHolder
         bool TryFollowMaster(Creature* pCreature);
 
     private:
+        // A linked slave, creature is resolved from the guids on demand and cleared when the slave leaves the map
+        struct LinkedSlave
+        {
+            uint32 dbGuid;
+            ObjectGuid guid;
+            Creature* creature;
+        };
+        typedef std::vector<LinkedSlave> LinkedSlaveList;
+
         // Structure associated to a master (entry case)
         struct InfoAndGuids
         {
             uint16 linkingFlag: 16;
             uint16 searchRange: 16;
-            std::list<std::pair<uint32, ObjectGuid>> linkedGuids;
+            LinkedSlaveList linkedSlaves;
             bool inUse = false;
         };
         // Structure associated to a master (guid case)
@@ -186,8 +198,9 @@ class CreatureLinkingHolder
         typedef std::multimap < uint32 /*Entry*/, ObjectGuid > BossGuidMap;
         typedef std::pair<BossGuidMap::const_iterator, BossGuidMap::const_iterator> BossGuidMapBounds;
 
-        // Helper function, to process a slave list
-        void ProcessSlaveGuidList(CreatureLinkingEvent eventType, Creature* pSource, uint32 flag, uint16 searchRange, std::list<std::pair<uint32, ObjectGuid>>& slaveGuidList, Unit* pEnemy);
+        // Helper functions, to add to and process a slave list
+        static void AddSlaveToList(LinkedSlaveList& slaveList, Creature* pCreature);
+        void ProcessSlaveGuidList(CreatureLinkingEvent eventType, Creature* pSource, uint32 flag, uint16 searchRange, LinkedSlaveList& slaveList, Unit* pEnemy);
         // Helper function, to process a single slave
         void ProcessSlave(CreatureLinkingEvent eventType, Creature* pSource, uint32 flag, Creature* pSlave, Unit* pEnemy);
         // Helper function to set following
@@ -52,6 +52,7 @@ void DynamicObject::RemoveFromWorld()
     {
         GetViewPoint().Event_RemovedFromWorld();
         GetMap()->GetObjectsStore().erase<DynamicObject>(GetObjectGuid(), (DynamicObject*)nullptr);
+        GetMap()->GetTriggerVolumeManager().Remove(m_triggerVolume);
     }
 
     Object::RemoveFromWorld();
@@ -139,9 +140,15 @@ void DynamicObject::Update(const uint32 diff)
     // have radius and work as persistent effect
     if (m_radius)
     {
-        // TODO: make a timer and update this in larger intervals
-        MaNGOS::DynamicObjectUpdater notifier(*this, caster, m_positive);
-        Cell::VisitAllObjects(this, notifier, m_radius);
+        if (!m_triggerVolume.IsRegistered())
+            GetMap()->GetTriggerVolumeManager().Add(m_triggerVolume, GetPositionX(), GetPositionY(), m_radius, GetObjectBoundingRadius());
+
+        // search only when a unit moved inside or the recheck interval passed
+        if (m_triggerVolume.ConsumeTrigger(GetMap()->GetCurrentClockTime()))
+        {
+            MaNGOS::DynamicObjectUpdater notifier(*this, caster, m_positive);
+            Cell::VisitAllObjects(this, notifier, m_radius);
+        }
     }
 
     if (deleteThis)
@@ -23,6 +23,7 @@
 #include "Server/DBCEnums.h"
 #include "Spells/SpellTargetDefines.h"
 #include "Entities/Unit.h"
+#include "Maps/TriggerVolumeManager.h"
 
 enum DynamicObjectType
 {
@@ -85,6 +86,7 @@ class DynamicObject : public WorldObject
         SpellEffectIndex m_effIndex;
         TimePoint m_aliveTime;
         float m_radius;                                     // radius apply persistent effect, 0 = no persistent effect
+        TriggerVolume m_triggerVolume;
         bool m_positive;
         GuidSet m_affected;
         SpellTarget m_target;
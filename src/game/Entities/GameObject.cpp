@@ -185,6 +185,7 @@ void GameObject::RemoveFromWorld()
         if (GetDbGuid())
             GetMap()->RemoveDbGuidObject(this);
 
+        GetMap()->GetTriggerVolumeManager().Remove(m_trapVolume);
         ClearGameObjectGroup();
     }
 
@@ -483,45 +484,52 @@ void GameObject::Update(const uint32 diff)
 
                         if (valid)
                         {
-                            // Should trap trigger?
-                            Unit* target = nullptr;                     // pointer to appropriate target if found any
+                            if (!m_trapVolume.IsRegistered() || !m_trapVolume.IsAt(GetPositionX(), GetPositionY(), radius))
+                                GetMap()->GetTriggerVolumeManager().Add(m_trapVolume, GetPositionX(), GetPositionY(), radius, GetObjectBoundingRadius());
 
-                            if (std::function<bool(Unit*)>* functor = sScriptDevAIMgr.OnTrapSearch(this))
+                            // search only when a unit moved inside or the recheck interval passed
+                            if (m_trapVolume.ConsumeTrigger(GetMap()->GetCurrentClockTime()))
                             {
-                                MaNGOS::AnyUnitFulfillingConditionInRangeCheck u_check(this, *functor, radius);
-                                MaNGOS::UnitSearcher<MaNGOS::AnyUnitFulfillingConditionInRangeCheck> checker(target, u_check);
-                                Cell::VisitAllObjects(this, checker, radius);
-                            }
-                            else
-                            {
-                                switch (goInfo->trapCustom.triggerOn)
+                                // Should trap trigger?
+                                Unit* target = nullptr;                     // pointer to appropriate target if found any
+
+                                if (std::function<bool(Unit*)>* functor = sScriptDevAIMgr.OnTrapSearch(this))
                                 {
-                                    case 1: // friendly
-                                    {
-                                        MaNGOS::AnyFriendlyUnitInObjectRangeCheck u_check(this, nullptr, radius);
-                                        MaNGOS::UnitSearcher<MaNGOS::AnyFriendlyUnitInObjectRangeCheck> checker(target, u_check);
-                                        Cell::VisitAllObjects(this, checker, radius);
-                                        break;
-                                    }
-                                    case 2: // all
-                                    {
-                                        MaNGOS::AnyUnitInObjectRangeCheck u_check(this, radius);
-                                        MaNGOS::UnitSearcher<MaNGOS::AnyUnitInObjectRangeCheck> checker(target, u_check);
-                                        Cell::VisitAllObjects(this, checker, radius);
-                                        break;
-                                    }
-                                    default: // unfriendly
+                                    MaNGOS::AnyUnitFulfillingConditionInRangeCheck u_check(this, *functor, radius);
+                                    MaNGOS::UnitSearcher<MaNGOS::AnyUnitFulfillingConditionInRangeCheck> checker(target, u_check);
+                                    Cell::VisitAllObjects(this, checker, radius);
+                                }
+                                else
+                                {
+                                    switch (goInfo->trapCustom.triggerOn)
                                     {
-                                        MaNGOS::AnyUnfriendlyUnitInObjectRangeCheck u_check(this, radius);
-                                        MaNGOS::UnitSearcher<MaNGOS::AnyUnfriendlyUnitInObjectRangeCheck> checker(target, u_check);
-                                        Cell::VisitAllObjects(this, checker, radius);
-                                        break;
+                                        case 1: // friendly
+                                        {
+                                            MaNGOS::AnyFriendlyUnitInObjectRangeCheck u_check(this, nullptr, radius);
+                                            MaNGOS::UnitSearcher<MaNGOS::AnyFriendlyUnitInObjectRangeCheck> checker(target, u_check);
+                                            Cell::VisitAllObjects(this, checker, radius);
+                                            break;
+                                        }
+                                        case 2: // all
+                                        {
+                                            MaNGOS::AnyUnitInObjectRangeCheck u_check(this, radius);
+                                            MaNGOS::UnitSearcher<MaNGOS::AnyUnitInObjectRangeCheck> checker(target, u_check);
+                                            Cell::VisitAllObjects(this, checker, radius);
+                                            break;
+                                        }
+                                        default: // unfriendly
+                                        {
+                                            MaNGOS::AnyUnfriendlyUnitInObjectRangeCheck u_check(this, radius);
+                                            MaNGOS::UnitSearcher<MaNGOS::AnyUnfriendlyUnitInObjectRangeCheck> checker(target, u_check);
+                                            Cell::VisitAllObjects(this, checker, radius);
+                                            break;
+                                        }
                                     }
                                 }
-                            }
 
-                            if (target && (!goInfo->trapCustom.triggerOn || !target->HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_NOT_SELECTABLE))) // do not trigger on hostile traps if not selectable
-                                Use(target);
+                                if (target && (!goInfo->trapCustom.triggerOn || !target->HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_NOT_SELECTABLE))) // do not trigger on hostile traps if not selectable
+                                    Use(target);
+                            }
                         }
                         else
                         {
@@ -26,6 +26,7 @@
 #include "AI/BaseAI/GameObjectAI.h"
 #include "Spells/SpellDefines.h"
 #include "Entities/GameObjectDefines.h"
+#include "Maps/TriggerVolumeManager.h"
 
 #include <array>
 
@@ -978,6 +979,7 @@ class GameObject : public WorldObject
         bool        m_spawnedByDefault;
         time_t      m_cooldownTime;                         // used as internal reaction delay time store (not state change reaction).
         // For traps/goober this: spell casting cooldown, for doors/buttons: reset time.
+        TriggerVolume m_trapVolume;                         // activation area of armed traps
 
         uint32      m_captureTimer;                         // (msecs) timer used for capture points
         float       m_captureSlider;                        // capture point slider value in range of [0..100]
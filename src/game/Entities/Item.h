@@ -381,6 +381,12 @@ class Item : public Object
         {
             uState = state;
         }
+        // reuse of a not owned item object for saving one more new copy of it (mass mail)
+        void SetNewCopyGuid(uint32 guidlow)
+        {
+            Object::_Create(guidlow, 0, HIGHGUID_ITEM);
+            uState = ITEM_NEW;
+        }
 
         bool HasQuest(uint32 quest_id) const override { return GetProto()->StartQuest == quest_id; }
         bool HasInvolvedQuest(uint32 /*quest_id*/) const override { return false; }
@@ -796,6 +796,7 @@ void WorldSession::SendListInventory(ObjectGuid vendorguid) const
                 }
 
                 // possible item coverting for BoA case
+                bool converted = false;
                 if (pProto->Flags & ITEM_FLAG_IS_BOUND_TO_ACCOUNT)
                 {
                     // convert if can use and then buy
@@ -803,7 +804,10 @@ void WorldSession::SendListInventory(ObjectGuid vendorguid) const
                     {
                         // checked at convert data loading as existed
                         if (uint32 newItemId = sObjectMgr.GetItemConvert(itemId, _player->getRaceMask()))
+                        {
                             pProto = ObjectMgr::GetItemPrototype(newItemId);
+                            converted = true;
+                        }
                     }
                 }
 
@@ -812,14 +816,26 @@ void WorldSession::SendListInventory(ObjectGuid vendorguid) const
                 // reputation discount
                 uint32 price = (crItem->ExtendedCost == 0 || pProto->Flags2 & ITEM_FLAG2_DONT_IGNORE_BUY_PRICE) ? uint32(floor(pProto->BuyPrice * discountMod)) : 0;
 
-                data << uint32(vendorslot + 1);             // client size expected counting from 1
-                data << uint32(pProto->ItemId);
-                data << uint32(pProto->DisplayInfoID);
-                data << uint32(crItem->maxcount <= 0 ? 0xFFFFFFFF : pCreature->GetVendorItemCurrentCount(crItem));
-                data << uint32(price);
-                data << uint32(pProto->MaxDurability);
-                data << uint32(pProto->BuyCount);
-                data << uint32(crItem->ExtendedCost);
+                if (converted)
+                {
+                    data << uint32(vendorslot + 1);         // client size expected counting from 1
+                    data << uint32(pProto->ItemId);
+                    data << uint32(pProto->DisplayInfoID);
+                    data << uint32(crItem->maxcount <= 0 ? 0xFFFFFFFF : pCreature->GetVendorItemCurrentCount(crItem));
+                    data << uint32(price);
+                    data << uint32(pProto->MaxDurability);
+                    data << uint32(pProto->BuyCount);
+                    data << uint32(crItem->ExtendedCost);
+                    continue;
+                }
+
+                // item data is prebuilt at load, only patch player and stock dependent fields
+                size_t row_pos = data.wpos();
+                data.append(crItem->packetRow, VENDOR_ITEM_ROW_SIZE);
+                data.put<uint32>(row_pos + VENDOR_ITEM_ROW_SLOT_OFFSET, vendorslot + 1);    // client size expected counting from 1
+                if (crItem->maxcount > 0)
+                    data.put<uint32>(row_pos + VENDOR_ITEM_ROW_COUNT_OFFSET, pCreature->GetVendorItemCurrentCount(crItem));
+                data.put<uint32>(row_pos + VENDOR_ITEM_ROW_PRICE_OFFSET, price);
             }
         }
     }
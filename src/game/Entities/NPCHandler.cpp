@@ -110,22 +110,12 @@ void WorldSession::HandleTrainerListOpcode(WorldPacket& recv_data)
 
 static void SendTrainerSpellHelper(WorldPacket& data, TrainerSpell const* tSpell, TrainerSpellState state, float fDiscountMod, bool /*can_learn_primary_prof*/, uint32 reqLevel)
 {
-    bool primary_prof_first_rank = sSpellMgr.IsPrimaryProfessionFirstRankSpell(tSpell->learnedSpell);
-
-    SpellChainNode const* chain_node = sSpellMgr.GetSpellChainNode(tSpell->learnedSpell);
-
-    data << uint32(tSpell->spell);                      // learned spell (or cast-spell in profession case)
-    data << uint8(state == TRAINER_SPELL_GREEN_DISABLED ? TRAINER_SPELL_GREEN : state);
-    data << uint32(floor(tSpell->spellCost * fDiscountMod));
-
-    data << uint32(0); // spells don't cost talent points
-    data << uint32(primary_prof_first_rank ? 1 : 0);    // must be equal prev. field to have learn button in enabled state
-    data << uint8(reqLevel);
-    data << uint32(tSpell->reqSkill);
-    data << uint32(tSpell->reqSkillValue);
-    data << uint32(!tSpell->IsCastable() && chain_node ? (chain_node->prev ? chain_node->prev : chain_node->req) : 0);
-    data << uint32(!tSpell->IsCastable() && chain_node && chain_node->prev ? chain_node->req : 0);
-    data << uint32(0);
+    // spell data is prebuilt at load, only patch player dependent fields
+    size_t row_pos = data.wpos();
+    data.append(tSpell->packetRow, TRAINER_SPELL_ROW_SIZE);
+    data.put<uint8>(row_pos + TRAINER_SPELL_ROW_STATE_OFFSET, uint8(state == TRAINER_SPELL_GREEN_DISABLED ? TRAINER_SPELL_GREEN : state));
+    data.put<uint32>(row_pos + TRAINER_SPELL_ROW_COST_OFFSET, uint32(floor(tSpell->spellCost * fDiscountMod)));
+    data.put<uint8>(row_pos + TRAINER_SPELL_ROW_LEVEL_OFFSET, uint8(reqLevel));
 }
 
 void WorldSession::SendTrainerList(ObjectGuid guid) const
@@ -61,6 +61,7 @@ Object::Object(): m_updateFlag(0), m_itsNewObject(false)
 
     m_inWorld           = false;
     m_objectUpdated     = false;
+    m_clientUpdateSlot  = CLIENT_UPDATE_SLOT_NONE;
     m_loot              = nullptr;
 }
 
@@ -3312,11 +3313,15 @@ bool WorldObject::IsUsingNewSpawningSystem() const
 void WorldObject::AddClientIAmAt(Player const* player)
 {
     m_clientGUIDsIAmAt.insert(player->GetObjectGuid());
+    if (GetTypeId() == TYPEID_PLAYER)
+        static_cast<Player*>(this)->InvalidateOutOfRangeGroupMembers();
 }
 
 void WorldObject::RemoveClientIAmAt(Player const* player)
 {
     m_clientGUIDsIAmAt.erase(player->GetObjectGuid());
+    if (GetTypeId() == TYPEID_PLAYER)
+        static_cast<Player*>(this)->InvalidateOutOfRangeGroupMembers();
 }
 
 bool WorldObject::CheckAndIncreaseCastCounter()
@@ -384,6 +384,8 @@ class WorldUpdateCounter
         uint32 m_tmStart;
 };
 
+#define CLIENT_UPDATE_SLOT_NONE uint32(-1)
+
 class Object
 {
     public:
@@ -437,6 +439,10 @@ class Object
         void MarkForClientUpdate();
         void SendForcedObjectUpdate();
 
+        // position in the client update queue of the map it was queued in, maintained by Map
+        uint32 GetClientUpdateSlot() const { return m_clientUpdateSlot; }
+        void SetClientUpdateSlot(uint32 slot) { m_clientUpdateSlot = slot; }
+
         void BuildValuesUpdateBlockForPlayer(UpdateData& data, Player* target) const;
         void BuildValuesUpdateBlockForPlayerWithFlags(UpdateData& data, Player* target, UpdateFieldFlags flags) const;
         void BuildValuesUpdateBlockForPlayer(UpdateData& data, UpdateMask& updateMask, Player* target) const;
@@ -694,6 +700,7 @@ class Object
     private:
         bool m_inWorld;
         bool m_itsNewObject;
+        uint32 m_clientUpdateSlot;
 
         PackedGuid m_PackGUID;
 
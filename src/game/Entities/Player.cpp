@@ -551,6 +551,8 @@ Player::Player(WorldSession* session): Unit(), m_taxiTracker(*this), m_mover(thi
     // group is initialized in the reference constructor
     SetGroupInvite(nullptr);
     m_groupUpdateMask = 0;
+    m_outOfRangeGroupMembersGeneration = 1;
+    m_outOfRangeGroupMembersBuilt = 0;
 
     duel = nullptr;
 
@@ -639,6 +641,10 @@ Player::Player(WorldSession* session): Unit(), m_taxiTracker(*this), m_mover(thi
 
     m_lastPotionId = 0;
 
+    m_initialSpellsDataValid = false;
+
+    m_savedQuestStatusCount = 0;
+
     m_activeSpec = 0;
     m_specsCount = 1;
 
@@ -1544,7 +1550,7 @@ void Player::Update(const uint32 diff)
             else
             {
                 q_status.m_timer -= diff;
-                if (q_status.uState != QUEST_NEW) q_status.uState = QUEST_CHANGED;
+                MarkQuestStatusChanged(*iter, q_status);
                 ++iter;
             }
         }
@@ -2238,6 +2244,9 @@ bool Player::TeleportTo(uint32 mapid, float x, float y, float z, float orientati
                 GetSession()->SendPacket(data);
             }
 
+            // destination terrain loads in background while the client shows the loading screen
+            sTerrainMgr.PreloadGrid(mapid, x, y);
+
             // remove from old map now
             if (oldmap)
                 oldmap->Remove(this, false);
@@ -3207,31 +3216,38 @@ void Player::OnExpansionChange()
 
 void Player::SendInitialSpells() const
 {
-    uint16 spellCount = 0;
+    // spell list is resent at every far teleport, keep it serialized between spell book changes
+    if (!m_initialSpellsDataValid)
+    {
+        uint16 spellCount = 0;
 
-    WorldPacket data(SMSG_INITIAL_SPELLS, (1 + 2 + 6 * m_spells.size() + 2 + m_cooldownMap.size() * (2 + 2 + 2 + 4 + 4)));
-    data << uint8(0);
+        m_initialSpellsData.clear();
+        m_initialSpellsData.reserve(2 + 6 * m_spells.size());
+        m_initialSpellsData << uint16(spellCount);          // spell count placeholder
 
-    const size_t countPos = data.wpos();
-    data << uint16(spellCount);                             // spell count placeholder
+        for (const auto& m_spell : m_spells)
+        {
+            PlayerSpell const& playerSpell = m_spell.second;
 
-    for (const auto& m_spell : m_spells)
-    {
-        PlayerSpell const& playerSpell = m_spell.second;
+            if (playerSpell.state == PLAYERSPELL_REMOVED)
+                continue;
 
-        if (playerSpell.state == PLAYERSPELL_REMOVED)
-            continue;
+            if (!playerSpell.active || playerSpell.disabled)
+                continue;
 
-        if (!playerSpell.active || playerSpell.disabled)
-            continue;
+            m_initialSpellsData << uint32(m_spell.first);
+            m_initialSpellsData << uint16(0);               // it's not slot id
 
-        data << uint32(m_spell.first);
-        data << uint16(0);                                  // it's not slot id
+            spellCount += 1;
+        }
 
-        spellCount += 1;
+        m_initialSpellsData.put<uint16>(0, spellCount);     // write real count value
+        m_initialSpellsDataValid = true;
     }
 
-    data.put<uint16>(countPos, spellCount);                 // write real count value
+    WorldPacket data(SMSG_INITIAL_SPELLS, (1 + m_initialSpellsData.size() + 2 + m_cooldownMap.size() * (2 + 2 + 2 + 4 + 4)));
+    data << uint8(0);
+    data.append(m_initialSpellsData);
 
     // write cooldown data
     uint32 cdCount = 0;
@@ -3416,6 +3432,8 @@ static inline bool IsUnlearnSpellsPacketNeededForSpell(uint32 spellId)
 
 bool Player::addSpell(uint32 spell_id, bool active, bool learning, bool dependent, bool disabled)
 {
+    m_initialSpellsDataValid = false;
+
     SpellEntry const* spellInfo = sSpellTemplate.LookupEntry<SpellEntry>(spell_id);
     if (!spellInfo)
     {
@@ -3819,6 +3837,8 @@ void Player::learnSpell(uint32 spell_id, bool dependent, bool talent)
 
 void Player::removeSpell(uint32 spell_id, bool disabled, bool learn_low_rank, bool sendUpdate)
 {
+    m_initialSpellsDataValid = false;
+
     PlayerSpellMap::iterator itr = m_spells.find(spell_id);
     if (itr == m_spells.end())
         return;
@@ -7799,6 +7819,8 @@ void Player::_ApplyItemBonuses(ItemPrototype const* proto, uint8 slot, bool appl
     if (only_level_scale && !ssv)
         return;
 
+    // stat dependants are recalculated once for all item stats
+    DeferStatUpdates();
     for (uint32 i = 0; i < MAX_ITEM_PROTO_STATS; ++i)
     {
         uint32 statType;
@@ -7970,6 +7992,7 @@ void Player::_ApplyItemBonuses(ItemPrototype const* proto, uint8 slot, bool appl
                 break;
         }
     }
+    ResumeStatUpdates();
 
     // Apply Spell Power from ScalingStatValue if set
     if (ssv)
@@ -14425,8 +14448,7 @@ void Player::AddQuest(Quest const* pQuest, Object* questGiver)
 
     SetQuestSlot(log_slot, quest_id, qtime);
 
-    if (questStatusData.uState != QUEST_NEW)
-        questStatusData.uState = QUEST_CHANGED;
+    MarkQuestStatusChanged(quest_id, questStatusData);
 
     // quest accept scripts
     if (questGiver)
@@ -14664,8 +14686,7 @@ void Player::RewardQuest(Quest const* pQuest, uint32 reward, Object* questGiver,
     if (pQuest->CanIncreaseRewardedQuestCounters())
     {
         q_status.m_rewarded = true;
-        if (q_status.uState != QUEST_NEW)
-            q_status.uState = QUEST_CHANGED;
+        MarkQuestStatusChanged(quest_id, q_status);
     }
 
     if (announce)
@@ -15383,8 +15404,7 @@ void Player::SetQuestStatus(uint32 quest_id, QuestStatus status)
 
         q_status.m_status = status;
 
-        if (q_status.uState != QUEST_NEW)
-            q_status.uState = QUEST_CHANGED;
+        MarkQuestStatusChanged(quest_id, q_status);
     }
 
     UpdateForQuestWorldObjects();
@@ -15416,7 +15436,7 @@ void Player::AdjustQuestReqItemCount(Quest const* pQuest, QuestStatusData& quest
                 uint32 curitemcount = GetItemCount(pQuest->ReqItemId[i], true);
 
                 questStatusData.m_itemcount[i] = std::min(curitemcount, reqitemcount);
-                if (questStatusData.uState != QUEST_NEW) questStatusData.uState = QUEST_CHANGED;
+                MarkQuestStatusChanged(pQuest->GetQuestId(), questStatusData);
             }
         }
     }
@@ -15446,8 +15466,7 @@ void Player::AreaExploredOrEventHappens(uint32 questId)
                 SendQuestCompleteEvent(questId);
                 q_status.m_explored = true;
 
-                if (q_status.uState != QUEST_NEW)
-                    q_status.uState = QUEST_CHANGED;
+                MarkQuestStatusChanged(questId, q_status);
             }
         }
         if (CanCompleteQuest(questId))
@@ -15524,8 +15543,7 @@ void Player::ItemAddedQuestCheck(uint32 entry, uint32 count)
                 {
                     uint32 additemcount = (curitemcount + count <= reqitemcount ? count : reqitemcount - curitemcount);
                     q_status.m_itemcount[j] += additemcount;
-                    if (q_status.uState != QUEST_NEW)
-                        q_status.uState = QUEST_CHANGED;
+                    MarkQuestStatusChanged(questid, q_status);
 
                     SendQuestUpdateAddItem(qInfo, j, curitemcount, additemcount);
                 }
@@ -15570,8 +15588,7 @@ void Player::ItemRemovedQuestCheck(uint32 entry, uint32 count)
                 {
                     uint32 remitemcount = (curItemCount <= reqItemCount ? count : count + reqItemCount - curItemCount);
                     q_status.m_itemcount[j] = curItemCount - remitemcount;
-                    if (q_status.uState != QUEST_NEW)
-                        q_status.uState = QUEST_CHANGED;
+                    MarkQuestStatusChanged(questid, q_status);
 
                     IncompleteQuest(questid);
                     UpdateForQuestWorldObjects();
@@ -15636,8 +15653,7 @@ void Player::KilledMonsterCredit(uint32 entry, ObjectGuid guid)
                         if (curkillcount < reqkillcount)
                         {
                             q_status.m_creatureOrGOcount[j] = curkillcount + addkillcount;
-                            if (q_status.uState != QUEST_NEW)
-                                q_status.uState = QUEST_CHANGED;
+                            MarkQuestStatusChanged(questid, q_status);
 
                             SendQuestUpdateAddCreatureOrGo(qInfo, guid, j, q_status.m_creatureOrGOcount[j]);
                         }
@@ -15692,8 +15708,7 @@ void Player::KilledPlayerCreditForQuest(uint16 count, Quest const* quest)
         count = std::min<uint16>(reqKill - curKill, count);
         questStatus.m_playerCount = curKill + count;
 
-        if (questStatus.uState != QUEST_NEW)
-            questStatus.uState = QUEST_CHANGED;
+        MarkQuestStatusChanged(questId, questStatus);
 
         SendQuestUpdateAddPlayer(quest, curKill + count);
     }
@@ -15760,8 +15775,7 @@ void Player::CastedCreatureOrGO(uint32 entry, ObjectGuid guid, uint32 spell_id,
             if (curCastCount < reqCastCount)
             {
                 q_status.m_creatureOrGOcount[j] = curCastCount + addCastCount;
-                if (q_status.uState != QUEST_NEW)
-                    q_status.uState = QUEST_CHANGED;
+                MarkQuestStatusChanged(questid, q_status);
 
                 SendQuestUpdateAddCreatureOrGo(qInfo, guid, j, q_status.m_creatureOrGOcount[j]);
             }
@@ -15811,7 +15825,7 @@ void Player::TalkedToCreature(uint32 entry, ObjectGuid guid)
                         if (curTalkCount < reqTalkCount)
                         {
                             q_status.m_creatureOrGOcount[j] = curTalkCount + addTalkCount;
-                            if (q_status.uState != QUEST_NEW) q_status.uState = QUEST_CHANGED;
+                            MarkQuestStatusChanged(questid, q_status);
 
                             SendQuestUpdateAddCreatureOrGo(qInfo, guid, j, q_status.m_creatureOrGOcount[j]);
                         }
@@ -17647,6 +17661,9 @@ void Player::_LoadQuestStatus(QueryResult* result)
         delete result;
     }
 
+    m_changedQuestStatus.clear();
+    m_savedQuestStatusCount = mQuestStatus.size();
+
     // clear quest log tail
     for (uint16 i = slot; i < MAX_QUEST_LOG_SIZE; ++i)
         SetQuestSlot(i, 0);
@@ -18816,61 +18833,75 @@ void Player::_SaveMail()
 
 void Player::_SaveQuestStatus()
 {
-    static SqlStatementID insertQuestStatus ;
+    // new entries are only known by the map having grown, walk it then
+    if (mQuestStatus.size() != m_savedQuestStatusCount)
+    {
+        for (auto& mQuestStatu : mQuestStatus)
+            _SaveQuestStatusEntry(mQuestStatu.first, mQuestStatu.second);
+    }
+    else
+    {
+        for (uint32 questId : m_changedQuestStatus)
+        {
+            QuestStatusMap::iterator itr = mQuestStatus.find(questId);
+            if (itr != mQuestStatus.end())
+                _SaveQuestStatusEntry(itr->first, itr->second);
+        }
+    }
 
-    static SqlStatementID updateQuestStatus ;
+    m_changedQuestStatus.clear();
+    m_savedQuestStatusCount = mQuestStatus.size();
+}
 
-    // we don't need transactions here.
-    for (auto& mQuestStatu : mQuestStatus)
+void Player::_SaveQuestStatusEntry(uint32 questId, QuestStatusData& questStatus)
+{
+    // new and changed rows share one upsert, the save transaction sends them as a single multi-row request
+    static SqlStatementID saveQuestStatus ;
+
+    switch (questStatus.uState)
     {
-        QuestStatusData& questStatus = mQuestStatu.second;
-        switch (questStatus.uState)
+        case QUEST_UNCHANGED:
+            return;
+        case QUEST_CHANGED:
         {
-            case QUEST_NEW :
+            Quest const* quest = sObjectMgr.GetQuestTemplate(questId);
+            if (quest->IsAutoComplete())
             {
-                SqlStatement stmt = CharacterDatabase.CreateStatement(insertQuestStatus, "INSERT INTO character_queststatus (guid,quest,status,rewarded,explored,timer,mobcount1,mobcount2,mobcount3,mobcount4,itemcount1,itemcount2,itemcount3,itemcount4,itemcount5,itemcount6) "
-                                    "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
-
-                stmt.addUInt32(GetGUIDLow());
-                stmt.addUInt32(mQuestStatu.first);
-                stmt.addUInt8(questStatus.m_status);
-                stmt.addUInt8(questStatus.m_rewarded);
-                stmt.addUInt8(questStatus.m_explored);
-                stmt.addUInt64(uint64(questStatus.m_timer / IN_MILLISECONDS + sWorld.GetGameTime()));
-                for (unsigned int k : questStatus.m_creatureOrGOcount)
-                    stmt.addUInt32(k);
-                for (unsigned int k : questStatus.m_itemcount)
-                    stmt.addUInt32(k);
-                stmt.Execute();
-            }
-            break;
-            case QUEST_CHANGED :
-            {
-                Quest const* quest = sObjectMgr.GetQuestTemplate(mQuestStatu.first);
-                if (quest->IsAutoComplete())
-                    continue;
-
-                SqlStatement stmt = CharacterDatabase.CreateStatement(updateQuestStatus, "UPDATE character_queststatus SET status = ?,rewarded = ?,explored = ?,timer = ?,"
-                                    "mobcount1 = ?,mobcount2 = ?,mobcount3 = ?,mobcount4 = ?,itemcount1 = ?,itemcount2 = ?,itemcount3 = ?,itemcount4 = ?,itemcount5 = ?,itemcount6 = ? WHERE guid = ? AND quest = ?");
-
-                stmt.addUInt8(questStatus.m_status);
-                stmt.addUInt8(questStatus.m_rewarded);
-                stmt.addUInt8(questStatus.m_explored);
-                stmt.addUInt64(uint64(questStatus.m_timer / IN_MILLISECONDS + sWorld.GetGameTime()));
-                for (unsigned int k : questStatus.m_creatureOrGOcount)
-                    stmt.addUInt32(k);
-                for (unsigned int k : questStatus.m_itemcount)
-                    stmt.addUInt32(k);
-                stmt.addUInt32(GetGUIDLow());
-                stmt.addUInt32(mQuestStatu.first);
-                stmt.Execute();
+                questStatus.uState = QUEST_UNCHANGED;
+                return;
             }
             break;
-            case QUEST_UNCHANGED:
-                break;
         }
-        questStatus.uState = QUEST_UNCHANGED;
+        case QUEST_NEW:
+            break;
     }
+
+    SqlStatement stmt = CharacterDatabase.CreateStatement(saveQuestStatus, "REPLACE INTO character_queststatus (guid,quest,status,rewarded,explored,timer,mobcount1,mobcount2,mobcount3,mobcount4,itemcount1,itemcount2,itemcount3,itemcount4,itemcount5,itemcount6) "
+                          "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+
+    stmt.addUInt32(GetGUIDLow());
+    stmt.addUInt32(questId);
+    stmt.addUInt8(questStatus.m_status);
+    stmt.addUInt8(questStatus.m_rewarded);
+    stmt.addUInt8(questStatus.m_explored);
+    stmt.addUInt64(uint64(questStatus.m_timer / IN_MILLISECONDS + sWorld.GetGameTime()));
+    for (unsigned int k : questStatus.m_creatureOrGOcount)
+        stmt.addUInt32(k);
+    for (unsigned int k : questStatus.m_itemcount)
+        stmt.addUInt32(k);
+    stmt.Execute();
+
+    questStatus.uState = QUEST_UNCHANGED;
+}
+
+void Player::MarkQuestStatusChanged(uint32 questId, QuestStatusData& questStatus)
+{
+    // QUEST_NEW entries are saved as a whole, only saved ones need to be remembered
+    if (questStatus.uState != QUEST_UNCHANGED)
+        return;
+
+    questStatus.uState = QUEST_CHANGED;
+    m_changedQuestStatus.push_back(questId);
 }
 
 void Player::_SaveDailyQuestStatus()
@@ -20032,12 +20063,17 @@ bool Player::IsRafResting() const
 
 void Player::ResetMap()
 {
+    // camera object belongs to the map being left
+    if (m_cinematicMgr)
+        m_cinematicMgr->EndCinematic();
+
     for (auto guid : m_clientGUIDs)
     {
         if (WorldObject* object = GetMap()->GetWorldObject(guid))
             object->RemoveClientIAmAt(this);
     }
     m_clientGUIDs.clear();
+    m_clientQuestGUIDs.clear();
     Unit::ResetMap();
 }
 
@@ -21202,15 +21238,35 @@ void Player::ReportedAfkBy(Player* reporter)
     }
 }
 
+// objects which need resend at quest status change, see UpdateForQuestWorldObjects
+static bool IsQuestRelatedClientObject(WorldObject const* target)
+{
+    if (target->GetObjectGuid().IsGameObject())
+        return sObjectMgr.IsGameObjectForQuests(target->GetEntry()) || sObjectMgr.IsGameObjectQuestObjective(target->GetEntry());
+
+    if (target->GetObjectGuid().IsCreatureOrVehicle())
+    {
+        SpellClickInfoMapBounds clickPair = sObjectMgr.GetSpellClickInfoMapBounds(target->GetEntry());
+        for (SpellClickInfoMap::const_iterator itr = clickPair.first; itr != clickPair.second; ++itr)
+            if (itr->second.questStart || itr->second.questEnd)
+                return true;
+    }
+
+    return false;
+}
+
 void Player::AddAtClient(WorldObject* target)
 {
     m_clientGUIDs.insert(target->GetObjectGuid());
+    if (IsQuestRelatedClientObject(target))
+        m_clientQuestGUIDs.insert(target->GetObjectGuid());
     target->AddClientIAmAt(this);
 }
 
 void Player::RemoveAtClient(WorldObject* target)
 {
     m_clientGUIDs.erase(target->GetObjectGuid());
+    m_clientQuestGUIDs.erase(target->GetObjectGuid());
     target->RemoveClientIAmAt(this);
 }
 
@@ -21556,6 +21612,24 @@ void Player::SendUpdateToOutOfRangeGroupMembers()
         charm->ResetAuraUpdateMask();
 }
 
+GuidVector const& Player::GetOutOfRangeGroupMembers()
+{
+    // read before the rebuild, an invalidation arriving meanwhile makes the next call rebuild again
+    uint32 const generation = m_outOfRangeGroupMembersGeneration;
+    if (m_outOfRangeGroupMembersBuilt != generation)
+    {
+        m_outOfRangeGroupMembers.clear();
+        if (Group* group = GetGroup())
+            for (GroupReference* itr = group->GetFirstMember(); itr != nullptr; itr = itr->next())
+                if (Player* player = itr->getSource())
+                    if (player != this && !player->HasAtClient(this))
+                        m_outOfRangeGroupMembers.push_back(player->GetObjectGuid());
+
+        m_outOfRangeGroupMembersBuilt = generation;
+    }
+    return m_outOfRangeGroupMembers;
+}
+
 void Player::SendTransferAbortedByLockStatus(MapEntry const* mapEntry, AreaLockStatus lockStatus, uint32 miscRequirement) const
 {
     MANGOS_ASSERT(mapEntry);
@@ -21990,11 +22064,11 @@ bool Player::HasQuestForGO(int32 GOId) const
 
 void Player::UpdateForQuestWorldObjects()
 {
-    if (m_clientGUIDs.empty())
+    if (m_clientQuestGUIDs.empty())
         return;
 
     UpdateData updateData;
-    for (auto m_clientGUID : m_clientGUIDs)
+    for (auto m_clientGUID : m_clientQuestGUIDs)
     {
         if (m_clientGUID.IsGameObject())
         {
@@ -22007,19 +22081,11 @@ void Player::UpdateForQuestWorldObjects()
             if (!obj)
                 continue;
 
-            // check if this unit requires quest specific flags
+            // check if this unit requires quest specific flags, entry spell click data checked at AddAtClient
             if (!obj->HasFlag(UNIT_NPC_FLAGS, UNIT_NPC_FLAG_SPELLCLICK))
                 continue;
 
-            SpellClickInfoMapBounds clickPair = sObjectMgr.GetSpellClickInfoMapBounds(obj->GetEntry());
-            for (SpellClickInfoMap::const_iterator _itr = clickPair.first; _itr != clickPair.second; ++_itr)
-            {
-                if (_itr->second.questStart || _itr->second.questEnd)
-                {
-                    obj->BuildCreateUpdateBlockForPlayer(&updateData, this);
-                    break;
-                }
-            }
+            obj->BuildCreateUpdateBlockForPlayer(&updateData, this);
         }
     }
     for (size_t i = 0; i < updateData.GetPacketCount(); ++i)
@@ -22532,17 +22598,16 @@ void Player::UpdateZoneDependentAuras()
 
 void Player::UpdateAreaDependentAuras()
 {
-    // remove auras from spells with area limitations
-    for (SpellAuraHolderMap::iterator iter = m_spellAuraHolders.begin(); iter != m_spellAuraHolders.end();)
+    // remove auras from spells with area limitations, copy the list as removal can remove other holders too
+    std::vector<SpellAuraHolder*> holders(m_locationRestrictedHolders);
+    for (SpellAuraHolder* holder : holders)
     {
+        if (holder->IsDeleted())
+            continue;
+
         // use m_zoneUpdateId for speed: UpdateArea called from UpdateZone or instead UpdateZone in both cases m_zoneUpdateId up-to-date
-        if (sSpellMgr.GetSpellAllowedInLocationError(iter->second->GetSpellProto(), GetMapId(), m_zoneUpdateId, m_areaUpdateId, this) != SPELL_CAST_OK)
-        {
-            RemoveSpellAuraHolder(iter->second);
-            iter = m_spellAuraHolders.begin();
-        }
-        else
-            ++iter;
+        if (sSpellMgr.GetSpellAllowedInLocationError(holder->GetSpellProto(), GetMapId(), m_zoneUpdateId, m_areaUpdateId, this) != SPELL_CAST_OK)
+            RemoveSpellAuraHolder(holder);
     }
 
     // some auras applied at subzone enter
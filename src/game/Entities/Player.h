@@ -43,6 +43,7 @@
 #include "Cinematics/CinematicMgr.h"
 #include "LFG/LFG.h"
 
+#include <atomic>
 #include <functional>
 #include <vector>
 
@@ -1906,6 +1907,7 @@ class Player : public Unit
         float GetManaBonusFromIntellect() const;
 
         bool UpdateStats(Stats stat) override;
+        void UpdateStatDependants(uint32 statMask) override;
         bool UpdateAllStats() override;
         void UpdateResistances(uint32 school) override;
         void UpdateArmor() override;
@@ -2472,6 +2474,8 @@ class Player : public Unit
         uint8 GetSubGroup() const { return m_group.getSubGroup(); }
         uint32 GetGroupUpdateFlag() const { return m_groupUpdateMask; }
         void SetGroupUpdateFlag(uint32 flag) { m_groupUpdateMask |= flag; }
+        GuidVector const& GetOutOfRangeGroupMembers();
+        void InvalidateOutOfRangeGroupMembers() { ++m_outOfRangeGroupMembersGeneration; }
         Player* GetNextRaidMemberWithLowestLifePercentage(float radius, AuraType noAuraType);
         PartyResult CanUninviteFromGroup() const;
         void UpdateGroupLeaderFlag(const bool remove = false);
@@ -2674,6 +2678,7 @@ class Player : public Unit
         void _SaveInventory();
         void _SaveMail();
         void _SaveQuestStatus();
+        void _SaveQuestStatusEntry(uint32 questId, QuestStatusData& questStatus);
         void _SaveDailyQuestStatus();
         void _SaveWeeklyQuestStatus();
         void _SaveMonthlyQuestStatus();
@@ -2734,6 +2739,8 @@ class Player : public Unit
         ObjectGuid m_curSelectionGuid;
 
         QuestStatusMap mQuestStatus;
+        std::vector<uint32> m_changedQuestStatus;           // saved entries changed since last save
+        size_t m_savedQuestStatusCount;                     // mQuestStatus size at last save, entries are never erased so growth means QUEST_NEW entries
 
         SkillStatusMap mSkillStatus;
 
@@ -2742,6 +2749,9 @@ class Player : public Unit
 
         PlayerMails m_mail;
         PlayerSpellMap m_spells;
+        // serialized spell list of SMSG_INITIAL_SPELLS, rebuilt only after spell book changes
+        mutable ByteBuffer m_initialSpellsData;
+        mutable bool m_initialSpellsDataValid;
         SpellCooldowns m_spellCooldowns;
         PlayerTalentMap m_talents[MAX_TALENT_SPEC_COUNT];
         uint32 m_lastPotionId;                              // last used health/mana potion in combat, that block next potion use
@@ -2826,6 +2836,9 @@ class Player : public Unit
         GroupReference m_originalGroup;
         Group* m_groupInvite;
         uint32 m_groupUpdateMask;
+        GuidVector m_outOfRangeGroupMembers;                // members without us at client, rebuilt on visibility or membership change
+        std::atomic<uint32> m_outOfRangeGroupMembersGeneration; // bumped from any thread to invalidate the list
+        uint32 m_outOfRangeGroupMembersBuilt;               // generation the list was built for
 
         // Player summoning
         time_t m_summon_expire;
@@ -2851,6 +2864,7 @@ class Player : public Unit
         void UpdateKnownCurrencies(uint32 itemId, bool apply);
 
         void AdjustQuestReqItemCount(Quest const* pQuest, QuestStatusData& questStatusData);
+        void MarkQuestStatusChanged(uint32 questId, QuestStatusData& questStatus);
 
         void SetCanDelayTeleport(bool setting) { m_bCanDelayTeleport = setting; }
         bool IsHasDelayedTeleport() const
@@ -2946,6 +2960,7 @@ class Player : public Unit
         std::set<SpellModifierPair>* m_consumedMods;
 
         GuidSet m_clientGUIDs;
+        GuidSet m_clientQuestGUIDs;                         // part of m_clientGUIDs which client state depends on quest status
 
         // Recruit-A-Friend
         uint8 m_grantableLevels;
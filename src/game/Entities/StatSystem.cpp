@@ -40,34 +40,45 @@ bool Player::UpdateStats(Stats stat)
     int32 oldValue = GetStat(stat);
     SetStat(stat, int32(value));
 
-    if (oldValue != value)
-        if (stat == STAT_STAMINA || stat == STAT_INTELLECT)
-            if (Pet* pet = GetPet())
-                pet->UpdateScalingAuras();
+    uint32 statMask = 1 << stat;
+    if (oldValue != value && (stat == STAT_STAMINA || stat == STAT_INTELLECT))
+        statMask |= STAT_UPDATE_PET_SCALING;
 
-    switch (stat)
+    if (IsDeferringStatUpdates())
+        m_pendingStatUpdates |= statMask;
+    else
+        UpdateStatDependants(statMask);
+    return true;
+}
+
+void Player::UpdateStatDependants(uint32 statMask)
+{
+    if (statMask & STAT_UPDATE_PET_SCALING)
+        if (Pet* pet = GetPet())
+            pet->UpdateScalingAuras();
+
+    if (statMask & (1 << STAT_STRENGTH))
+        UpdateShieldBlockValue();
+
+    if (statMask & (1 << STAT_AGILITY))
     {
-        case STAT_STRENGTH:
-            UpdateShieldBlockValue();
-            break;
-        case STAT_AGILITY:
-            UpdateArmor();
-            UpdateAllCritPercentages();
-            UpdateDodgePercentage();
-            break;
-        case STAT_STAMINA:   UpdateMaxHealth(); break;
-        case STAT_INTELLECT:
-            UpdateMaxPower(POWER_MANA);
-            UpdateAllSpellCritChances();
-            UpdateArmor();                                  // SPELL_AURA_MOD_RESISTANCE_OF_INTELLECT_PERCENT, only armor currently
-            break;
+        UpdateAllCritPercentages();
+        UpdateDodgePercentage();
+    }
 
-        case STAT_SPIRIT:
-            break;
+    if (statMask & (1 << STAT_STAMINA))
+        UpdateMaxHealth();
 
-        default:
-            break;
+    if (statMask & (1 << STAT_INTELLECT))
+    {
+        UpdateMaxPower(POWER_MANA);
+        UpdateAllSpellCritChances();
     }
+
+    // SPELL_AURA_MOD_RESISTANCE_OF_INTELLECT_PERCENT, only armor currently
+    if (statMask & ((1 << STAT_AGILITY) | (1 << STAT_INTELLECT)))
+        UpdateArmor();
+
     // Need update (exist AP from stat auras)
     UpdateAttackPowerAndDamage();
     UpdateAttackPowerAndDamage(true);
@@ -80,7 +91,7 @@ bool Player::UpdateStats(Stats stat)
     uint32 mask = 0;
     AuraList const& modRatingFromStat = GetAurasByType(SPELL_AURA_MOD_RATING_FROM_STAT);
     for (auto i : modRatingFromStat)
-        if (Stats(i->GetMiscBValue()) == stat)
+        if (statMask & (1 << i->GetMiscBValue()))
             mask |= i->GetMiscValue();
     if (mask)
     {
@@ -88,7 +99,6 @@ bool Player::UpdateStats(Stats stat)
             if (mask & (1 << rating))
                 ApplyRatingMod(CombatRating(rating), 0, true);
     }
-    return true;
 }
 
 void Player::ApplySpellPowerBonus(int32 amount, bool apply)
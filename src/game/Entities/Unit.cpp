@@ -302,6 +302,8 @@ Unit::Unit() :
 
     m_transform = 0;
     m_canModifyStats = false;
+    m_statUpdateDeferCount = 0;
+    m_pendingStatUpdates = 0;
 
     for (auto& i : m_spellImmune)
         i.clear();
@@ -5707,6 +5709,8 @@ bool Unit::AddSpellAuraHolder(SpellAuraHolder* holder)
     holder->_AddSpellAuraHolder();
     holder->SetCreationDelayFlag();
     m_spellAuraHolders.insert(SpellAuraHolderMap::value_type(holder->GetId(), holder));
+    if (sSpellMgr.IsSpellLocationRestricted(aurSpellInfo))
+        m_locationRestrictedHolders.push_back(holder);
 
     for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
         if (Aura* aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
@@ -6352,6 +6356,14 @@ void Unit::RemoveSpellAuraHolder(SpellAuraHolder* holder, AuraRemoveMode mode)
         }
     }
 
+    // searched without IsSpellLocationRestricted, spell_area can be reloaded while the holder is applied
+    auto restrictedItr = std::find(m_locationRestrictedHolders.begin(), m_locationRestrictedHolders.end(), holder);
+    if (restrictedItr != m_locationRestrictedHolders.end())
+    {
+        *restrictedItr = m_locationRestrictedHolders.back();
+        m_locationRestrictedHolders.pop_back();
+    }
+
     holder->SetRemoveMode(mode);
 
     uint32 auraFlags = holder->GetAuraFlags();
@@ -11186,6 +11198,10 @@ bool Unit::HandleStatModifier(UnitMods unitMod, UnitModifierType modifierType, f
     if (!CanModifyStats())
         return false;
 
+    // everything else reads derived stat values, bring them up to date first
+    if (unitMod < UNIT_MOD_STAT_START || unitMod >= UNIT_MOD_STAT_END)
+        FlushStatUpdates();
+
     switch (unitMod)
     {
         case UNIT_MOD_STAT_STRENGTH:
@@ -11226,6 +11242,16 @@ bool Unit::HandleStatModifier(UnitMods unitMod, UnitModifierType modifierType, f
     return true;
 }
 
+void Unit::FlushStatUpdates()
+{
+    if (!m_pendingStatUpdates)
+        return;
+
+    uint32 statMask = m_pendingStatUpdates;
+    m_pendingStatUpdates = 0;
+    UpdateStatDependants(statMask);
+}
+
 float Unit::GetModifierValue(UnitMods unitMod, UnitModifierType modifierType) const
 {
     if (unitMod >= UNIT_MOD_END || modifierType >= MODIFIER_TYPE_END)
@@ -13331,8 +13357,11 @@ void Unit::OnRelocated()
         m_last_notified_position.z = GetPositionZ();
 
         GetViewPoint().Call_UpdateVisibilityForOwner();
-        UpdateObjectVisibility();
+        // passengers moved along with their vehicle are updated by it in one pass
+        if (!IsBoarded() || !GetTransportInfo()->DeferVisibilityUpdate())
+            UpdateObjectVisibility();
     }
+    GetMap()->GetTriggerVolumeManager().OnUnitRelocated(*this);
     ScheduleAINotify(World::GetRelocationAINotifyDelay());
 }
 
@@ -331,6 +331,9 @@ enum UnitMods
     UNIT_MOD_POWER_END = UNIT_MOD_RUNIC_POWER + 1
 };
 
+// extra UpdateStatDependants mask bit, set when owner stamina or intellect changed
+#define STAT_UPDATE_PET_SCALING (1 << MAX_STATS)
+
 enum BaseModGroup
 {
     CRIT_PERCENTAGE,
@@ -2109,7 +2112,13 @@ class Unit : public WorldObject
         Powers GetPowerTypeByAuraGroup(UnitMods unitMod) const;
         bool CanModifyStats() const { return m_canModifyStats; }
         void SetCanModifyStats(bool modifyStats) { m_canModifyStats = modifyStats; }
+        // stat dependants (derived values) of modified stats are recalculated once when the outermost defer scope ends
+        void DeferStatUpdates() { ++m_statUpdateDeferCount; }
+        void ResumeStatUpdates() { if (--m_statUpdateDeferCount == 0) FlushStatUpdates(); }
+        bool IsDeferringStatUpdates() const { return m_statUpdateDeferCount != 0; }
+        void FlushStatUpdates();
         virtual bool UpdateStats(Stats stat) = 0;
+        virtual void UpdateStatDependants(uint32 /*statMask*/) {}
         virtual bool UpdateAllStats() = 0;
         virtual void UpdateResistances(uint32 school) = 0;
         virtual void UpdateArmor() = 0;
@@ -2607,6 +2616,7 @@ class Unit : public WorldObject
         SpellAuraHolderMap::iterator m_spellAuraHoldersUpdateIterator; // != end() in Unit::m_spellAuraHolders update and point to next element
         AuraList m_deletedAuras;                            // auras removed while in ApplyModifier and waiting deleted
         SpellAuraHolderList m_deletedHolders;
+        std::vector<SpellAuraHolder*> m_locationRestrictedHolders; // holders of m_spellAuraHolders that can become invalid at zone/area change
         std::map<uint32, Aura*> m_classScripts;
         std::vector<Aura*> m_scriptedLocations[SCRIPT_LOCATION_MAX];
         std::vector<Aura*> m_scalingAuras;
@@ -2628,6 +2638,8 @@ class Unit : public WorldObject
         WeaponDamageInfo m_weaponDamageInfo;
 
         bool m_canModifyStats;
+        uint32 m_statUpdateDeferCount;
+        uint32 m_pendingStatUpdates;                        // mask of stats with outdated dependants
         // std::list< spellEffectPair > AuraSpells[TOTAL_AURAS];  // TODO: use this if ok for mem
         VisibleAuraMap m_visibleAuras;
 
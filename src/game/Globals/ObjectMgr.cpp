@@ -8967,6 +8967,12 @@ int ObjectMgr::GetOrNewIndexForLocale(LocaleConstant loc)
 void ObjectMgr::LoadGameObjectForQuests()
 {
     mGameObjectForQuestSet.clear();                         // need for reload case
+    mGameObjectQuestObjectiveSet.clear();
+
+    for (QuestMap::const_iterator itr = mQuestTemplates.begin(); itr != mQuestTemplates.end(); ++itr)
+        for (int j = 0; j < QUEST_OBJECTIVES_COUNT; ++j)
+            if (itr->second->ReqCreatureOrGOId[j] < 0)
+                mGameObjectQuestObjectiveSet.insert(uint32(-itr->second->ReqCreatureOrGOId[j]));
 
     if (!sGOStorage.GetMaxEntry())
     {
@@ -9697,6 +9703,8 @@ void ObjectMgr::LoadTrainers(char const* tableName, bool isTemplates)
                 sLog.outErrorDb("Table `%s` (Entry: %u) has `condition_id` = %u but does not exist.", tableName, entry, trainerSpell.conditionId);
         }
 
+        trainerSpell.BuildPacketRow();
+
         ++count;
     }
     while (result->NextRow());
@@ -9707,6 +9715,17 @@ void ObjectMgr::LoadTrainers(char const* tableName, bool isTemplates)
     sLog.outString();
 }
 
+void ObjectMgr::RebuildTrainerPacketRows()
+{
+    for (auto& trainer : m_mCacheTrainerTemplateSpellMap)
+        for (auto& trainerSpell : trainer.second.spellList)
+            trainerSpell.second.BuildPacketRow();
+
+    for (auto& trainer : m_mCacheTrainerSpellMap)
+        for (auto& trainerSpell : trainer.second.spellList)
+            trainerSpell.second.BuildPacketRow();
+}
+
 void ObjectMgr::LoadTrainerTemplates()
 {
     LoadTrainers("npc_trainer_template", true);
@@ -596,6 +596,12 @@ class ObjectMgr
             return mGameObjectForQuestSet.find(entry) != mGameObjectForQuestSet.end();
         }
 
+        // GO required by quest objectives (ReqCreatureOrGOId)
+        bool IsGameObjectQuestObjective(uint32 entry) const
+        {
+            return mGameObjectQuestObjectiveSet.find(entry) != mGameObjectQuestObjectiveSet.end();
+        }
+
         GossipText const* GetGossipText(uint32 Text_ID) const;
 
         QuestgiverGreeting const* GetQuestgiverGreetingData(uint32 entry, uint32 type) const;
@@ -796,6 +802,7 @@ class ObjectMgr
         void LoadVendors() { LoadVendors("npc_vendor", false); }
         void LoadTrainerTemplates();
         void LoadTrainers() { LoadTrainers("npc_trainer", false); }
+        void RebuildTrainerPacketRows();                    // after spell chains reload, rows contain chain data
 
         void LoadBroadcastText();
         void LoadBroadcastTextLocales();
@@ -1323,6 +1330,7 @@ class ObjectMgr
         QuestAreaTriggerMap mQuestAreaTriggerMap;
         TavernAreaTriggerSet mTavernAreaTriggerSet;
         GameObjectForQuestSet mGameObjectForQuestSet;
+        GameObjectForQuestSet mGameObjectQuestObjectiveSet;
         GossipTextMap       mGossipText;
         AreaTriggerMap      mAreaTriggers;
 
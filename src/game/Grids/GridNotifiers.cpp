@@ -38,6 +38,20 @@ void VisibleChangesNotifier::Visit(CameraMapType& m)
     }
 }
 
+void VisibleChangesGroupNotifier::Visit(CameraMapType& m)
+{
+    for (auto& iter : m)
+    {
+        Camera* camera = iter.getSource();
+        ObjectGuid const& viewerGuid = camera->GetOwner()->GetObjectGuid();
+        for (size_t i = 0; i < i_objects.size(); ++i)
+        {
+            camera->UpdateVisibilityOf(i_objects[i]);
+            m_unvisitedGuids[i].erase(viewerGuid);
+        }
+    }
+}
+
 void VisibleNotifier::Notify()
 {
     Player& player = *i_camera.GetOwner();
@@ -59,6 +59,23 @@ namespace MaNGOS
         GuidSet m_unvisitedGuids;
     };
 
+    // VisibleChangesNotifier for several objects at once (passengers moved with their vehicle), cells are visited only once
+    struct VisibleChangesGroupNotifier
+    {
+        std::vector<WorldObject*> const& i_objects;
+
+        explicit VisibleChangesGroupNotifier(std::vector<WorldObject*> const& objects) : i_objects(objects)
+        {
+            m_unvisitedGuids.reserve(objects.size());
+            for (WorldObject* object : objects)
+                m_unvisitedGuids.push_back(object->GetClientGuidsIAmAt());
+        }
+        template<class T> void Visit(GridRefManager<T>&) {}
+        void Visit(CameraMapType&);
+
+        std::vector<GuidSet> m_unvisitedGuids;
+    };
+
     struct MessageDeliverer
     {
         Player const& i_player;
@@ -755,12 +755,41 @@ void Group::UpdatePlayerOutOfRange(Player* pPlayer)
     WorldPacket data;
     WorldSession::BuildPartyMemberStatsChangedPacket(pPlayer, data);
 
+    // recipients are cached for the current group only (original group while in battleground raid is not)
+    if (pPlayer->GetGroup() == this)
+    {
+        // cached by guid, a member may have logged out since the list was built
+        for (ObjectGuid const& guid : pPlayer->GetOutOfRangeGroupMembers())
+            if (Player* player = sObjectMgr.GetPlayer(guid))
+                player->GetSession()->SendPacket(data);
+        return;
+    }
+
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
         if (Player* player = itr->getSource())
             if (player != pPlayer && !player->HasAtClient(pPlayer))
                 player->GetSession()->SendPacket(data);
 }
 
+void Group::LinkMember(GroupReference* pRef)
+{
+    m_memberMgr.insertFirst(pRef);
+    InvalidateOutOfRangeMembers();
+}
+
+void Group::DelinkMember(GroupReference* pRef)
+{
+    pRef->getSource()->InvalidateOutOfRangeGroupMembers();
+    InvalidateOutOfRangeMembers();
+}
+
+void Group::InvalidateOutOfRangeMembers()
+{
+    for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
+        if (Player* player = itr->getSource())
+            player->InvalidateOutOfRangeGroupMembers();
+}
+
 void Group::UpdatePlayerOnlineStatus(Player* player, bool online /*= true*/)
 {
     if (!player)
@@ -264,6 +264,7 @@ class Group
         void SendUpdateTo(Player* player);
         void SendUpdate();
         void UpdatePlayerOutOfRange(Player* pPlayer);
+        void InvalidateOutOfRangeMembers();
         void UpdatePlayerOnlineStatus(Player* player, bool online = true);
         void UpdateOfflineLeader(time_t time, uint32 delay);
         // ignore: GUID of player that will be ignored
@@ -287,8 +288,8 @@ class Group
         ObjectGuid const& GetMasterLooterGuid() const { return m_masterLooterGuid; }
         ObjectGuid const& GetCurrentLooterGuid() const { return m_currentLooterGuid; }
 
-        void LinkMember(GroupReference* pRef) { m_memberMgr.insertFirst(pRef); }
-        void DelinkMember(GroupReference* /*pRef*/) const { }
+        void LinkMember(GroupReference* pRef);
+        void DelinkMember(GroupReference* pRef);
 
         InstanceGroupBind* BindToInstance(DungeonPersistentState* state, bool permanent, bool load = false);
         void UnbindInstance(uint32 mapid, uint8 difficulty, bool unload = false);
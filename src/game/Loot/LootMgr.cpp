@@ -551,10 +551,10 @@ bool LootItem::IsAllowed(Player const* player, Loot const* loot) const
 // ------- Loot Roll -------
 //
 
-// Send the roll for the whole group
-void GroupLootRoll::SendStartRoll()
+// Build the roll start packet, the allowed choices are set per player by the caller
+void GroupLootRoll::BuildStartRollPacket(WorldPacket& data) const
 {
-    WorldPacket data(SMSG_LOOT_START_ROLL, (8 + 4 + 4 + 4 + 4 + 4 + 4 + 1));
+    data.Initialize(SMSG_LOOT_START_ROLL, (8 + 4 + 4 + 4 + 4 + 4 + 4 + 1));
     data << m_loot->GetLootGuid();                          // creature guid what we're looting
     data << uint32(m_loot->GetLootTarget()->GetMapId());    // 3.3.3 mapid
     data << uint32(m_itemSlot);                             // item slot in loot
@@ -563,26 +563,45 @@ void GroupLootRoll::SendStartRoll()
     data << uint32(m_lootItem->randomPropertyId);           // item random property ID
     data << uint32(m_lootItem->count);                      // items in stack
     data << uint32(LOOT_ROLL_TIMEOUT);                      // the countdown time to choose "need" or "greed"
+    data << uint8(0);                                       // roll type mask, allowed choices (placeholder, last byte)
+}
 
-    size_t voteMaskPos = data.wpos();
-    data << uint8(0);                                       // roll type mask, allowed choices (placeholder)
+RollVoteMask GroupLootRoll::GetVoteMaskFor(Player* player) const
+{
+    RollVoteMask mask = m_voteMask;
+    // In NEED_BEFORE_GREED need disabled for non-usable item for player
+    if (m_loot->m_lootMethod == NEED_BEFORE_GREED && player->CanUseItem(m_lootItem->itemProto) != EQUIP_ERR_OK)
+        mask = RollVoteMask(mask & ~ROLL_VOTE_MASK_NEED);
+    return mask;
+}
 
-    for (RollVoteMap::const_iterator itr = m_rollVoteMap.begin(); itr != m_rollVoteMap.end(); ++itr)
-    {
-        if (itr->second.vote == ROLL_NOT_VALID)
-            continue;
+// Send the start of the rolls to the whole group
+void GroupLootRoll::SendStartRolls(Loot const& loot, std::vector<GroupLootRoll*> const& rolls)
+{
+    if (rolls.empty())
+        return;
 
-        Player* plr = sObjectMgr.GetPlayer(itr->first);
+    std::vector<WorldPacket> packets(rolls.size());
+    for (size_t i = 0; i < rolls.size(); ++i)
+        rolls[i]->BuildStartRollPacket(packets[i]);
+
+    for (auto const& playerGuid : loot.m_ownerSet)
+    {
+        Player* plr = sObjectMgr.GetPlayer(playerGuid);
         if (!plr || !plr->GetSession())
             continue;
-        // dependent from player
-        RollVoteMask mask = m_voteMask;
-        // In NEED_BEFORE_GREED need disabled for non-usable item for player
-        if (m_loot->m_lootMethod == NEED_BEFORE_GREED && plr->CanUseItem(m_lootItem->itemProto) != EQUIP_ERR_OK)
-            mask = RollVoteMask(mask & ~ROLL_VOTE_MASK_NEED);
-        data.put<uint8>(voteMaskPos, uint8(mask));
 
-        plr->GetSession()->SendPacket(data);
+        for (size_t i = 0; i < rolls.size(); ++i)
+        {
+            GroupLootRoll const* roll = rolls[i];
+            RollVoteMap::const_iterator voteItr = roll->m_rollVoteMap.find(playerGuid);
+            if (voteItr == roll->m_rollVoteMap.end() || voteItr->second.vote == ROLL_NOT_VALID)
+                continue;
+
+            // dependent from player
+            packets[i].put<uint8>(packets[i].wpos() - 1, uint8(roll->GetVoteMaskFor(plr)));
+            plr->GetSession()->SendPacket(packets[i]);
+        }
     }
 }
 
@@ -688,6 +707,7 @@ GroupLootRoll::~GroupLootRoll()
 
 // Try to start the group roll for the specified item (it may fail for quest item or any condition
 // If this method return false the roll have to be removed from the container to avoid any problem
+// Start packets are not sent here, caller have to send them with SendStartRolls
 bool GroupLootRoll::TryToStart(Loot& loot, uint32 itemSlot)
 {
     if (!m_isStarted)
@@ -728,8 +748,9 @@ bool GroupLootRoll::TryToStart(Loot& loot, uint32 itemSlot)
         if (playerCount > 1)                                    // check if more than one player can loot this item
         {
             // start the roll
-            SendStartRoll();
             m_endTime = time(nullptr) + (LOOT_ROLL_TIMEOUT / 1000);
+            m_notVoted = playerCount;
+            m_winnerItr = m_rollVoteMap.end();
             m_isStarted = true;
             return true;
         }
@@ -748,11 +769,37 @@ bool GroupLootRoll::PlayerVote(Player* player, RollVote vote)
     if (voterItr == m_rollVoteMap.end())
         return false;
 
+    // only one vote per eligible player, a second one would reroll the number
+    if (voterItr->second.vote != ROLL_NOT_EMITED_YET)
+        return false;
+
+    switch (vote)
+    {
+        case ROLL_PASS:
+        case ROLL_NEED:
+        case ROLL_GREED:
+        case ROLL_DISENCHANT:
+            break;
+        default:                                            // Roll removed case
+            return false;
+    }
+
     voterItr->second.vote = vote;
+    --m_notVoted;
 
-    if (vote != ROLL_PASS && vote != ROLL_NOT_VALID)
+    if (vote != ROLL_PASS)
+    {
         voterItr->second.number = urand(1, 100);
 
+        // need is prioritized over greed and disenchant, passing excludes a player from winning loot
+        if (m_winnerItr == m_rollVoteMap.end())
+            m_winnerItr = voterItr;
+        else if (vote == ROLL_NEED && m_winnerItr->second.vote != ROLL_NEED)
+            m_winnerItr = voterItr;
+        else if ((vote == ROLL_NEED) == (m_winnerItr->second.vote == ROLL_NEED) && voterItr->second.number > m_winnerItr->second.number)
+            m_winnerItr = voterItr;
+    }
+
     switch (vote)
     {
         case ROLL_PASS:                                     // Player choose pass
@@ -778,72 +825,16 @@ bool GroupLootRoll::PlayerVote(Player* player, RollVote vote)
             player->GetAchievementMgr().UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_ROLL_GREED, 1);
             break;
         }
-        default:                                            // Roll removed case
-            return false;
+        default:
+            break;
     }
     return true;
 }
 
-// check if we can found a winner for this roll or if timer is expired
-bool GroupLootRoll::UpdateRoll()
-{
-    RollVoteMap::const_iterator winnerItr = m_rollVoteMap.end();
-
-    if (AllPlayerVoted(winnerItr) || m_endTime <= time(nullptr))
-    {
-        Finish(winnerItr);
-        return true;
-    }
-    return false;
-}
-
-/**
-* \brief: Check if all player have voted and return true in that case. Also return current winner.
-* \param: RollVoteMap::const_iterator& winnerItr > will be different than m_rollCoteMap.end() if winner exist. (Someone voted greed or need)
-* \returns: bool > true if all players voted
-**/
-bool GroupLootRoll::AllPlayerVoted(RollVoteMap::const_iterator& winnerItr)
-{
-    uint32 notVoted = 0;
-    bool isSomeoneNeed = false;
-
-    winnerItr = m_rollVoteMap.end();
-    for (RollVoteMap::const_iterator itr = m_rollVoteMap.begin(); itr != m_rollVoteMap.end(); ++itr)
-    {
-        switch (itr->second.vote)
-        {
-            case ROLL_NEED:
-                if (!isSomeoneNeed || winnerItr == m_rollVoteMap.end() || itr->second.number > winnerItr->second.number)
-                {
-                    isSomeoneNeed = true;                                               // first passage will force to set winner because need is prioritized
-                    winnerItr = itr;
-                }
-                break;
-            case ROLL_GREED:
-            case ROLL_DISENCHANT:
-                if (!isSomeoneNeed)                                                      // if at least one need is detected then winner can't be a greed
-                {
-                    if (winnerItr == m_rollVoteMap.end() || itr->second.number > winnerItr->second.number)
-                        winnerItr = itr;
-                }
-                break;
-            // Explicitly passing excludes a player from winning loot, so no action required.
-            case ROLL_PASS:
-                break;
-            case ROLL_NOT_EMITED_YET:
-                ++notVoted;
-                break;
-            default:
-                break;
-        }
-    }
-
-    return notVoted == 0;
-}
-
 // terminate the roll
-void GroupLootRoll::Finish(RollVoteMap::const_iterator& winnerItr)
+void GroupLootRoll::Finish()
 {
+    RollVoteMap::const_iterator winnerItr = m_winnerItr;
     m_lootItem->isBlocked = false;
     if (winnerItr == m_rollVoteMap.end())
     {
@@ -1544,6 +1535,7 @@ void Loot::GroupCheck()
     m_isChecked = true;
     PlayerList playerList;
     Player* masterLooter = nullptr;
+    std::vector<GroupLootRoll*> startedRolls;
     for (auto playerGuid : m_ownerSet)
     {
         Player* player = sObjectAccessor.FindPlayer(playerGuid);
@@ -1571,12 +1563,20 @@ void Loot::GroupCheck()
 
             if (m_roll.find(itemSlot) == m_roll.end() && lootItem->IsAllowed(player, this))
             {
-                if (!m_roll[itemSlot].TryToStart(*this, itemSlot))      // Create and try to start a roll
+                GroupLootRoll& roll = m_roll[itemSlot];
+                if (!roll.TryToStart(*this, itemSlot))                  // Create and try to start a roll
                     m_roll.erase(m_roll.find(itemSlot));                // Cannot start roll so we have to delete it (find will not fail as the item was just created)
+                else
+                {
+                    m_rollExpiry.emplace(roll.GetEndTime(), itemSlot);
+                    startedRolls.push_back(&roll);
+                }
             }
         }
     }
 
+    GroupLootRoll::SendStartRolls(*this, startedRolls);
+
     // in master loot case we have to send looter list to client
     if (masterLooter)
     {
@@ -2192,13 +2192,23 @@ bool Loot::AutoStore(Player* player, bool broadcast /*= false*/, uint32 bag /*=
 void Loot::Update()
 {
     m_isChanged = false;
-    GroupLootRollMap::iterator itr = m_roll.begin();
-    while (itr != m_roll.end())
+
+    // rolls are finished at last vote, only expired ones are left to handle here
+    if (m_rollExpiry.empty() || m_rollExpiry.top().first > time(nullptr))
+        return;
+
+    time_t now = time(nullptr);
+    while (!m_rollExpiry.empty() && m_rollExpiry.top().first <= now)
     {
-        if (itr->second.UpdateRoll())
-            m_roll.erase(itr++);
-        else
-            ++itr;
+        uint32 itemSlot = m_rollExpiry.top().second;
+        m_rollExpiry.pop();
+
+        GroupLootRollMap::iterator itr = m_roll.find(itemSlot);
+        if (itr == m_roll.end() || itr->second.GetEndTime() > now)
+            continue;
+
+        itr->second.Finish();
+        m_roll.erase(itr);
     }
 }
 
@@ -2263,6 +2273,7 @@ void Loot::Clear()
     m_masterOwnerGuid.Clear();
     m_currentLooterGuid.Clear();
     m_roll.clear();
+    m_rollExpiry = GroupLootRollExpiryQueue();
     m_maxEnchantSkill = 0;
     m_haveItemOverThreshold = false;
     m_isChecked = false;
@@ -3100,6 +3111,13 @@ void LootMgr::PlayerVote(Player* player, ObjectGuid const& lootTargetGuid, uint3
             default:
                 break;
         }
+
+        // last vote decides the roll, no need to wait for the loot update
+        if (roll->AllPlayerVoted())
+        {
+            roll->Finish();
+            loot->m_roll.erase(itemSlot);
+        }
     }
 }
 
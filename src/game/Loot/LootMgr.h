@@ -24,6 +24,7 @@
 #include "Globals/SharedDefines.h"
 
 #include <vector>
+#include <queue>
 #include "Entities/Bag.h"
 
 #define LOOT_ROLL_TIMEOUT  (1*MINUTE*IN_MILLISECONDS)
@@ -35,6 +36,7 @@ class WorldObject;
 class LootTemplate;
 class Loot;
 class WorldSession;
+class WorldPacket;
 struct LootItem;
 struct ItemPrototype;
 
@@ -136,21 +138,25 @@ class GroupLootRoll
     public:
         typedef std::unordered_map<ObjectGuid, PlayerRollVote> RollVoteMap;
 
-        GroupLootRoll() : m_rollVoteMap(ROLL_VOTE_MASK_ALL), m_isStarted(false), m_lootItem(nullptr), m_loot(nullptr), m_itemSlot(0), m_voteMask(), m_endTime(0)
+        GroupLootRoll() : m_rollVoteMap(ROLL_VOTE_MASK_ALL), m_isStarted(false), m_lootItem(nullptr), m_loot(nullptr), m_itemSlot(0), m_voteMask(), m_endTime(0), m_notVoted(0)
         {}
         ~GroupLootRoll();
 
         bool TryToStart(Loot& loot, uint32 itemSlot);
         bool PlayerVote(Player* player, RollVote vote);
-        bool UpdateRoll();
+        bool AllPlayerVoted() const { return m_notVoted == 0; }
+        time_t GetEndTime() const { return m_endTime; }
+        void Finish();
+
+        // send start of all rolls started together, each eligible player receives its packets in one burst
+        static void SendStartRolls(Loot const& loot, std::vector<GroupLootRoll*> const& rolls);
 
     private:
-        void SendStartRoll();
+        void BuildStartRollPacket(WorldPacket& data) const;
+        RollVoteMask GetVoteMaskFor(Player* player) const;
         void SendAllPassed();
         void SendRoll(ObjectGuid const& targetGuid, uint32 rollNumber, uint32 rollType);
         void SendLootRollWon(ObjectGuid const& targetGuid, uint32 rollNumber, RollVote rollType);
-        void Finish(RollVoteMap::const_iterator& winnerItr);
-        bool AllPlayerVoted(RollVoteMap::const_iterator& winnerItr);
         RollVoteMap           m_rollVoteMap;
         bool                  m_isStarted;
         LootItem*             m_lootItem;
@@ -158,8 +164,12 @@ class GroupLootRoll
         uint32                m_itemSlot;
         RollVoteMask          m_voteMask;
         time_t                m_endTime;
+        uint32                m_notVoted;                   // eligible players that have not voted yet
+        RollVoteMap::const_iterator m_winnerItr;            // current best vote, end() if nobody need/greed yet
 };
 typedef std::unordered_map<uint32, GroupLootRoll> GroupLootRollMap;
+// roll end time and item slot, earliest end on top
+typedef std::priority_queue<std::pair<time_t, uint32>, std::vector<std::pair<time_t, uint32> >, std::greater<std::pair<time_t, uint32> > > GroupLootRollExpiryQueue;
 
 struct LootStoreItem
 {
@@ -376,6 +386,7 @@ class Loot
         bool             m_isChanged;                     // true if at least one item is looted
         bool             m_isFakeLoot;                    // nothing to loot but will sparkle for empty windows
         GroupLootRollMap m_roll;                          // used if an item is under rolling
+        GroupLootRollExpiryQueue m_rollExpiry;            // end times of m_roll entries, entries of already finished rolls are skipped
         GuidSet          m_playersLooting;                // player who opened loot windows
         GuidSet          m_playersOpened;                 // players that have released the corpse
         TimePoint        m_createTime;                    // create time (used to refill loot if need)
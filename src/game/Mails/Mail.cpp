@@ -343,6 +343,103 @@ void MailDraft::SendMailTo(MailReceiver const& receiver, MailSender const& sende
         deleteIncludedItems();
 }
 
+/**
+ * Sends copies of this mail to many offline characters in one transaction. Attached items are cloned once and
+ * saved under a new guid per receiver, all rows of a table go out as consecutive inserts that the transaction
+ * merges into multi-row statements. Receivers must not be online, their in-game mail list is not updated.
+ *
+ * @param receivers guids of the receiving characters, deleted ones are skipped
+ * @param sender    the sender of the mails
+ * @param checked   the mail check mask
+ */
+void MailDraft::SendMailToOffline(std::vector<ObjectGuid> const& receivers, MailSender const& sender, MailCheckMask checked)
+{
+    if (receivers.empty())
+        return;
+
+    // characters may have been deleted since the receiver list was built
+    std::ostringstream ss;
+    ss << "SELECT guid FROM characters WHERE guid IN (";
+    for (size_t i = 0; i < receivers.size(); ++i)
+        ss << (i ? "," : "") << receivers[i].GetCounter();
+    ss << ")";
+
+    std::vector<uint32> existing;
+    existing.reserve(receivers.size());
+    if (QueryResult* result = CharacterDatabase.Query(ss.str().c_str()))
+    {
+        do
+            existing.push_back((*result)[0].GetUInt32());
+        while (result->NextRow());
+        delete result;
+    }
+
+    if (existing.empty())
+        return;
+
+    std::vector<Item*> templateItems;
+    for (auto& mailItem : m_items)
+        if (Item* item = mailItem.second->CloneItem(mailItem.second->GetCount()))
+            templateItems.push_back(item);
+
+    time_t deliver_time = time(nullptr);
+    time_t expire_time = deliver_time + ((m_COD > 0) ? 3 * DAY : 30 * DAY);
+
+    std::vector<uint32> mailIds(existing.size());
+    std::vector<uint32> itemGuids(existing.size() * templateItems.size());
+
+    CharacterDatabase.BeginTransaction();
+
+    for (size_t i = 0; i < existing.size(); ++i)
+    {
+        mailIds[i] = sObjectMgr.GenerateMailID();
+        for (size_t j = 0; j < templateItems.size(); ++j)
+        {
+            uint32 itemGuid = sObjectMgr.GenerateItemLowGuid();
+            templateItems[j]->SetNewCopyGuid(itemGuid);
+            templateItems[j]->SaveToDB();
+            itemGuids[i * templateItems.size() + j] = itemGuid;
+        }
+    }
+
+    static SqlStatementID insMail;
+    static SqlStatementID insMailItem;
+
+    for (size_t i = 0; i < existing.size(); ++i)
+    {
+        SqlStatement stmt = CharacterDatabase.CreateStatement(insMail, "INSERT INTO mail (id,messageType,stationery,mailTemplateId,sender,receiver,subject,body,has_items,expire_time,deliver_time,money,cod,checked) VALUES (?,?,?,?,?,?,?,?,?,?,?,?,?,?)");
+        stmt.addUInt32(mailIds[i]);
+        stmt.addUInt32(sender.GetMailMessageType());
+        stmt.addUInt32(sender.GetStationery());
+        stmt.addUInt32(GetMailTemplateId());
+        stmt.addUInt32(sender.GetSenderId());
+        stmt.addUInt32(existing[i]);
+        stmt.addString(GetSubject());
+        stmt.addString(GetBody());
+        stmt.addUInt32(templateItems.empty() ? 0 : 1);
+        stmt.addUInt64(uint64(expire_time));
+        stmt.addUInt64(uint64(deliver_time));
+        stmt.addUInt32(m_money);
+        stmt.addUInt32(m_COD);
+        stmt.addUInt32(checked);
+        stmt.Execute();
+    }
+
+    for (size_t i = 0; i < existing.size(); ++i)
+    {
+        for (size_t j = 0; j < templateItems.size(); ++j)
+        {
+            SqlStatement stmt = CharacterDatabase.CreateStatement(insMailItem, "INSERT INTO mail_items (mail_id,item_guid,item_template,receiver) VALUES (?,?,?,?)");
+            stmt.PExecute(mailIds[i], itemGuids[i * templateItems.size() + j], templateItems[j]->GetEntry(), existing[i]);
+        }
+    }
+
+    CharacterDatabase.CommitTransaction();
+
+    for (Item* item : templateItems)
+        delete item;
+}
+
 /**
  * Generate items from template at mails loading (this happens when mail with mail template items send in time when receiver has been offline)
  *
@@ -64,6 +64,13 @@ struct MassMailerQueryHandler
         while (result->NextRow());
         delete result;
     }
+
+    // queued after a batch transaction, the async queue executes requests in order
+    void HandleBatchWritten(QueryResult* result)
+    {
+        delete result;
+        sMassMailMgr.BatchWritten();
+    }
 } massMailerQueryHandler;
 
 void MassMailMgr::AddMassMailTask(MailDraft* mailProto, const MailSender& sender, char const* query)
@@ -76,46 +83,65 @@ void MassMailMgr::Update(bool sendall /*= false*/)
     if (m_massMails.empty())
         return;
 
-    uint32 maxcount = sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK);
+    uint32 batchSize = sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK);
+    uint32 maxQueued = sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_MAX_QUEUED);
+    uint32 batches = 0;
 
     do
     {
+        // every batch is one async transaction, don't let mass mails flood the queue for regular saves
+        if (!sendall && (batches >= maxQueued || m_batchesInFlight >= maxQueued))
+            return;
+
         MassMail& task = m_massMails.front();
 
-        while (!task.m_receivers.empty() && (sendall || maxcount > 0))
+        std::vector<ObjectGuid> offlineReceivers;
+        ObjectGuid lastReceiver;
+        uint32 count = 0;
+
+        while (!task.m_receivers.empty() && count < batchSize)
         {
             uint32 receiver_lowguid = *task.m_receivers.begin();
             task.m_receivers.erase(task.m_receivers.begin());
+            ++count;
 
             ObjectGuid receiver_guid = ObjectGuid(HIGHGUID_PLAYER, receiver_lowguid);
-            Player* receiver = sObjectMgr.GetPlayer(receiver_guid);
 
-            // last case. can be just send
+            // last case. proto mail itself is sent after the batch used it
             if (task.m_receivers.empty())
             {
-                // prevent mail return
-                task.m_protoMail->SendMailTo(MailReceiver(receiver, receiver_guid), task.m_sender, MAIL_CHECK_MASK_RETURNED);
-
-                if (!sendall)
-                    --maxcount;
+                lastReceiver = receiver_guid;
                 break;
             }
 
-            // need clone draft
-            MailDraft draft;
-            draft.CloneFrom(*task.m_protoMail);
+            // online players get the mail in their mail list right away
+            if (Player* receiver = sObjectMgr.GetPlayer(receiver_guid))
+            {
+                // need clone draft
+                MailDraft draft;
+                draft.CloneFrom(*task.m_protoMail);
 
-            // prevent mail return
-            draft.SendMailTo(MailReceiver(receiver, receiver_guid), task.m_sender, MAIL_CHECK_MASK_RETURNED);
+                // prevent mail return
+                draft.SendMailTo(MailReceiver(receiver, receiver_guid), task.m_sender, MAIL_CHECK_MASK_RETURNED);
+                continue;
+            }
 
-            if (!sendall)
-                --maxcount;
+            offlineReceivers.push_back(receiver_guid);
         }
 
+        // prevent mail return
+        task.m_protoMail->SendMailToOffline(offlineReceivers, task.m_sender, MAIL_CHECK_MASK_RETURNED);
+        CharacterDatabase.AsyncQuery(&massMailerQueryHandler, &MassMailerQueryHandler::HandleBatchWritten, "SELECT 1");
+        ++m_batchesInFlight;
+        ++batches;
+
+        if (!lastReceiver.IsEmpty())
+            task.m_protoMail->SendMailTo(MailReceiver(sObjectMgr.GetPlayer(lastReceiver), lastReceiver), task.m_sender, MAIL_CHECK_MASK_RETURNED);
+
         if (task.m_receivers.empty())
             m_massMails.pop_front();
     }
-    while (!m_massMails.empty() && (sendall || maxcount > 0));
+    while (!m_massMails.empty());
 }
 
 void MassMailMgr::GetStatistic(uint32& tasks, uint32& mails, uint32& needTime) const
@@ -128,8 +154,8 @@ void MassMailMgr::GetStatistic(uint32& tasks, uint32& mails, uint32& needTime) c
 
     mails = mailsCount;
 
-    // 50 msecs is tick length
-    needTime = 50 * mailsCount / sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK) / IN_MILLISECONDS;
+    // 50 msecs is tick length, best case with idle character database
+    needTime = 50 * mailsCount / (sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK) * sWorld.getConfig(CONFIG_UINT32_MASS_MAILER_MAX_QUEUED)) / IN_MILLISECONDS;
 }
 
 /*! @} */
@@ -45,7 +45,7 @@
 class MassMailMgr
 {
     public:                                                 // Constructors
-        MassMailMgr() {}
+        MassMailMgr() : m_batchesInFlight(0) {}
 
     public:                                                 // Accessors
         void GetStatistic(uint32& tasks, uint32& mails, uint32& needTime) const;
@@ -92,6 +92,11 @@ class MassMailMgr
          */
         void Update(bool sendall = false);
 
+        /**
+         * Called when the character database finished writing a batch queued by Update
+         */
+        void BatchWritten() { if (m_batchesInFlight) --m_batchesInFlight; }
+
     private:
 
         /// Mass mail task store mail prototype and receivers list who not get mail yet
@@ -114,6 +119,8 @@ class MassMailMgr
 
         /// List of current queued mass mail tasks
         MassMailList m_massMails;
+        /// Batches handed to the character database and not yet written
+        uint32 m_batchesInFlight;
 };
 
 #define sMassMailMgr MaNGOS::Singleton<MassMailMgr>::Instance()
@@ -779,6 +779,10 @@ void TerrainInfo::CleanUpGrids(const uint32 diff)
     if (!i_timer.Passed())
         return;
 
+    // the terrain preload thread references and loads grids at any time
+    LOCK_GUARD lock(m_mutex);
+    LOCK_GUARD refLock(m_refMutex);
+
     for (int y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
     {
         for (int x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
@@ -1247,38 +1251,53 @@ GridMap* TerrainInfo::GetGrid(const float x, const float y, bool loadOnlyMap /*=
     return pMap;
 }
 
-GridMap* TerrainInfo::LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnly /*= false*/)
+GridMap* TerrainInfo::LoadGridMap(const uint32 x, const uint32 y)
 {
-    if ((m_GridMaps[x][y] && mapOnly) || VMAP::VMapFactory::createOrGetVMapManager()->IsTileLoaded(m_mapId, x, y))
+    LOCK_GUARD lock(m_mutex);
+    // double checked lock pattern
+    if (!m_GridMaps[x][y])
     {
-        // nothing to load here
-        return m_GridMaps[x][y];
-    }
+        GridMap* map = new GridMap();
 
-    {
-        LOCK_GUARD lock(m_mutex);
-        // double checked lock pattern
-        if (!m_GridMaps[x][y])
+        // map file name
+        int len = sWorld.GetDataPath().length() + strlen("maps/%03u%02u%02u.map") + 1;
+        char* tmp = new char[len];
+        snprintf(tmp, len, (char*)(sWorld.GetDataPath() + "maps/%03u%02u%02u.map").c_str(), m_mapId, x, y);
+        DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Loading map %s", tmp);
+
+        if (!map->loadData(tmp))
         {
-            GridMap* map = new GridMap();
+            sLog.outError("Error load map file: %s", tmp);
+            //assert(false);
+        }
 
-            // map file name
-            int len = sWorld.GetDataPath().length() + strlen("maps/%03u%02u%02u.map") + 1;
-            char* tmp = new char[len];
-            snprintf(tmp, len, (char*)(sWorld.GetDataPath() + "maps/%03u%02u%02u.map").c_str(), m_mapId, x, y);
-            DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Loading map %s", tmp);
+        delete[] tmp;
+        m_GridMaps[x][y] = map;
+    }
 
-            if (!map->loadData(tmp))
-            {
-                sLog.outError("Error load map file: %s", tmp);
-                //assert(false);
-            }
+    return m_GridMaps[x][y];
+}
 
-            delete[] tmp;
-            m_GridMaps[x][y] = map;
-        }
+GridMap* TerrainInfo::PreloadGridMap(const uint32 x, const uint32 y)
+{
+    MANGOS_ASSERT(x < MAX_NUMBER_OF_GRIDS);
+    MANGOS_ASSERT(y < MAX_NUMBER_OF_GRIDS);
+
+    // reference first, CleanUpGrids only deletes unreferenced grids under m_mutex
+    RefGrid(x, y);
+    return LoadGridMap(x, y);
+}
+
+GridMap* TerrainInfo::LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnly /*= false*/)
+{
+    if ((m_GridMaps[x][y] && mapOnly) || VMAP::VMapFactory::createOrGetVMapManager()->IsTileLoaded(m_mapId, x, y))
+    {
+        // nothing to load here
+        return m_GridMaps[x][y];
     }
 
+    LoadGridMap(x, y);
+
     // we'll load the rest later
     if (mapOnly)
         return m_GridMaps[x][y];
@@ -1337,12 +1356,17 @@ float TerrainInfo::GetWaterLevel(float x, float y, float z, float* pGround /*= n
 INSTANTIATE_SINGLETON_2(TerrainManager, CLASS_LOCK);
 INSTANTIATE_CLASS_MUTEX(TerrainManager, std::mutex);
 
-TerrainManager::TerrainManager()
+// preloaded grids stay referenced this long, enough for the client to get through the loading screen
+#define TERRAIN_PRELOAD_HOLD_TIME (30 * IN_MILLISECONDS)
+
+TerrainManager::TerrainManager() : m_preloadStop(false)
 {
 }
 
 TerrainManager::~TerrainManager()
 {
+    StopPreloadWorker();
+
     for (auto& it : i_TerrainMap)
         delete it.second;
 }
@@ -1383,6 +1407,27 @@ void TerrainManager::UnloadTerrain(const uint32 mapId)
 
 void TerrainManager::Update(const uint32 diff)
 {
+    {
+        std::lock_guard<std::mutex> lock(m_preloadMutex);
+        m_heldGrids.insert(m_heldGrids.end(), m_preloadedGrids.begin(), m_preloadedGrids.end());
+        m_preloadedGrids.clear();
+    }
+
+    for (size_t i = 0; i < m_heldGrids.size();)
+    {
+        GridPreload& preload = m_heldGrids[i];
+        if (preload.holdTime > diff)
+        {
+            preload.holdTime -= diff;
+            ++i;
+            continue;
+        }
+
+        ReleasePreload(preload);
+        m_heldGrids[i] = m_heldGrids.back();
+        m_heldGrids.pop_back();
+    }
+
     // global garbage collection for GridMap objects and VMaps
     for (auto& iter : i_TerrainMap)
         iter.second->CleanUpGrids(diff);
@@ -1390,12 +1435,114 @@ void TerrainManager::Update(const uint32 diff)
 
 void TerrainManager::UnloadAll()
 {
+    StopPreloadWorker();
+
+    // terrain objects are deleted below, preload references don't matter anymore
+    m_preloadQueue.clear();
+    m_preloadedGrids.clear();
+    m_heldGrids.clear();
+
     for (auto& it : i_TerrainMap)
         delete it.second;
 
     i_TerrainMap.clear();
 }
 
+void TerrainManager::PreloadGrid(uint32 mapId, float x, float y)
+{
+    GridPair p = MaNGOS::ComputeGridPair(x, y);
+    if (p.x_coord >= MAX_NUMBER_OF_GRIDS || p.y_coord >= MAX_NUMBER_OF_GRIDS)
+        return;
+
+    GridPreload preload;
+    preload.terrain = LoadTerrain(mapId);
+    preload.x = (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord;
+    preload.y = (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord;
+    preload.holdTime = TERRAIN_PRELOAD_HOLD_TIME;
+
+    // keeps the terrain object alive until the preload is released
+    preload.terrain->AddRef();
+
+    std::lock_guard<std::mutex> lock(m_preloadMutex);
+    if (m_preloadStop)
+    {
+        preload.terrain->Release();
+        return;
+    }
+
+    if (!m_preloadThread.joinable())
+        m_preloadThread = std::thread(&TerrainManager::PreloadWorker, this);
+
+    m_preloadQueue.push_back(preload);
+    m_preloadCondition.notify_one();
+}
+
+// reads a file through so the following synchronous load is served from the OS file cache
+static void WarmFileCache(std::string const& fileName)
+{
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (!file)
+        return;
+
+    char buffer[64 * 1024];
+    while (fread(buffer, 1, sizeof(buffer), file) == sizeof(buffer))
+        ;
+
+    fclose(file);
+}
+
+void TerrainManager::PreloadWorker()
+{
+    std::unique_lock<std::mutex> lock(m_preloadMutex);
+    while (true)
+    {
+        m_preloadCondition.wait(lock, [this]() { return m_preloadStop || !m_preloadQueue.empty(); });
+        if (m_preloadStop)
+            return;
+
+        GridPreload preload = m_preloadQueue.front();
+        m_preloadQueue.pop_front();
+        lock.unlock();
+
+        // height map is shared through TerrainInfo and loaded for real. vmap and mmap tiles are only read,
+        // their trees belong to the map update threads and get built when the grid is created.
+        // VMapManager is not touched here, it is not safe against CleanUpGrids
+        preload.terrain->PreloadGridMap(preload.x, preload.y);
+
+        uint32 mapId = preload.terrain->GetMapId();
+        char fileName[32];
+        // see VMAP::StaticMapTree::getTileFileName, tile coords are stored swapped
+        snprintf(fileName, sizeof(fileName), "%03u_%02u_%02u.vmtile", mapId, preload.y, preload.x);
+        WarmFileCache(sWorld.GetDataPath() + "vmaps/" + fileName);
+        snprintf(fileName, sizeof(fileName), "%03u%02u%02u.mmtile", mapId, preload.x, preload.y);
+        WarmFileCache(sWorld.GetDataPath() + "mmaps/" + fileName);
+
+        lock.lock();
+        m_preloadedGrids.push_back(preload);
+    }
+}
+
+void TerrainManager::StopPreloadWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_preloadMutex);
+        m_preloadStop = true;
+    }
+    m_preloadCondition.notify_all();
+
+    if (m_preloadThread.joinable())
+        m_preloadThread.join();
+}
+
+void TerrainManager::ReleasePreload(GridPreload const& preload)
+{
+    preload.terrain->Unload(preload.x, preload.y);
+
+    // same as a map going away, terrain of a map nobody arrived at is freed
+    if (preload.terrain->Release())
+        UnloadTerrain(preload.terrain->GetMapId());
+}
+
 uint32 TerrainManager::GetAreaIdByAreaFlag(uint16 areaflag, uint32 map_id)
 {
     AreaTableEntry const* entry = GetAreaEntryByAreaFlagAndMap(areaflag, map_id);
@@ -27,7 +27,11 @@
 #include "Maps/GridMapDefines.h"
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 class Creature;
 class Unit;
@@ -164,12 +168,13 @@ class TerrainInfo : public Referencable<std::atomic_long>
         // this method should be used only by TerrainManager
         // to cleanup unreferenced GridMap objects - they are too heavy
         // to destroy them dynamically, especially on highly populated servers
-        // THIS METHOD IS NOT THREAD-SAFE!!!! AND IT SHOULDN'T BE THREAD-SAFE!!!!
+        // must not run concurrently with map updates, only the preload thread is synchronized with it
         void CleanUpGrids(const uint32 diff);
 
     protected:
         friend class Map;
         friend class ObjectMgr;
+        friend class TerrainManager;
         // load/unload terrain data
         GridMap* Load(const uint32 x, const uint32 y, bool mapOnly = false);
         void Unload(const uint32 x, const uint32 y);
@@ -180,6 +185,9 @@ class TerrainInfo : public Referencable<std::atomic_long>
 
         GridMap* GetGrid(const float x, const float y, bool loadOnlyMap = false);
         GridMap* LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnly = false);
+        GridMap* LoadGridMap(const uint32 x, const uint32 y);
+        // references and loads the height map only, safe to call from the terrain preload thread
+        GridMap* PreloadGridMap(const uint32 x, const uint32 y);
 
         int RefGrid(const uint32& x, const uint32& y);
         int UnrefGrid(const uint32& x, const uint32& y);
@@ -211,6 +219,9 @@ class TerrainManager : public MaNGOS::Singleton<TerrainManager, MaNGOS::ClassLev
         void Update(const uint32 diff);
         void UnloadAll();
 
+        // loads terrain of a far teleport destination in the background while the client shows the loading screen
+        void PreloadGrid(uint32 mapId, float x, float y);
+
         uint16 GetAreaFlag(uint32 mapid, float x, float y, float z) const
         {
             TerrainInfo* pData = const_cast<TerrainManager*>(this)->LoadTerrain(mapid);
@@ -242,6 +253,25 @@ class TerrainManager : public MaNGOS::Singleton<TerrainManager, MaNGOS::ClassLev
 
         typedef MaNGOS::ClassLevelLockable<TerrainManager, std::mutex>::Lock Guard;
         TerrainDataMap i_TerrainMap;
+
+        struct GridPreload
+        {
+            TerrainInfo* terrain;                           // referenced until the hold time expires
+            uint32 x, y;
+            uint32 holdTime;
+        };
+
+        void PreloadWorker();
+        void StopPreloadWorker();
+        void ReleasePreload(GridPreload const& preload);
+
+        std::thread m_preloadThread;
+        std::mutex m_preloadMutex;
+        std::condition_variable m_preloadCondition;
+        std::deque<GridPreload> m_preloadQueue;             // waiting for the worker
+        std::vector<GridPreload> m_preloadedGrids;          // loaded by the worker, picked up by Update
+        std::vector<GridPreload> m_heldGrids;               // world thread only
+        bool m_preloadStop;
 };
 
 #define sTerrainMgr TerrainManager::Instance()
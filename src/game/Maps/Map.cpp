@@ -37,6 +37,7 @@
 #include "Maps/MapPersistentStateMgr.h"
 #include "Vmap/VMapFactory.h"
 #include "MotionGenerators/MoveMap.h"
+#include "MotionGenerators/PathFinder.h"
 #include "Calendar/Calendar.h"
 #include "Chat/Chat.h"
 #include "Weather/Weather.h"
@@ -83,6 +84,8 @@ Map::~Map()
     delete m_weatherSystem;
     m_weatherSystem = nullptr;
 
+    delete m_chasePathCache;
+
     for (auto transport : m_transports)
     {
         transport->Object::RemoveFromWorld();
@@ -226,7 +229,9 @@ Map::Map(uint32 id, time_t expiry, uint32 InstanceId, uint8 SpawnMode)
       i_data(nullptr), i_script_id(0), m_transportsIterator(m_transports.begin()), i_defaultLight(GetDefaultMapLight(id)), m_spawnManager(*this),
       m_variableManager(this)
 {
+    memset(marked_cells, 0, sizeof(marked_cells));
     m_weatherSystem = new WeatherSystem(this);
+    m_chasePathCache = new ChasePathCache();
 #ifdef BUILD_ELUNA
     sEluna->OnCreate(this);
 #endif
@@ -473,6 +478,69 @@ void Map::ForceLoadGrid(float x, float y)
     }
 }
 
+Creature* Map::AcquireCinematicObject(Player* player, uint32 cameraId, Position const& pos)
+{
+    uint32 const now = WorldTimer::tickTime();
+    for (auto itr = m_cinematicObjects.begin(); itr != m_cinematicObjects.end(); ++itr)
+    {
+        if (itr->cameraId != cameraId || itr->startTime / CINEMATIC_UPDATEDIFF != now / CINEMATIC_UPDATEDIFF)
+            continue;
+
+        // despawned in the meantime, summon a new one
+        if (!GetCreature(itr->guid))
+        {
+            m_cinematicObjects.erase(itr);
+            break;
+        }
+
+        ++itr->viewers;
+        return itr->object;
+    }
+
+    Creature* object = player->SummonCreature(VISUAL_WAYPOINT, pos.x, pos.y, pos.z, 0.0f, TEMPSPAWN_TIMED_DESPAWN, 5 * MINUTE * IN_MILLISECONDS);
+    if (!object)
+        return nullptr;
+
+    object->SetActiveObjectState(true);
+    m_cinematicObjects.push_back({ object->GetObjectGuid(), object, cameraId, now, 1, std::numeric_limits<uint32>::max() });
+    return object;
+}
+
+void Map::ReleaseCinematicObject(ObjectGuid guid)
+{
+    for (auto itr = m_cinematicObjects.begin(); itr != m_cinematicObjects.end(); ++itr)
+    {
+        if (itr->guid != guid)
+            continue;
+
+        // removed only when the last viewer left it
+        if (--itr->viewers == 0)
+        {
+            if (Creature* object = GetCreature(guid))
+                object->AddObjectToRemoveList();
+            m_cinematicObjects.erase(itr);
+        }
+        return;
+    }
+}
+
+bool Map::AdvanceCinematicObject(Creature* object, uint32 maxStep, uint32& step)
+{
+    for (auto& share : m_cinematicObjects)
+    {
+        if (share.object != object)
+            continue;
+
+        // tick time is the same for every viewer updated in this tick, so they all get the same step
+        step = std::min(WorldTimer::getMSTimeDiff(share.startTime, WorldTimer::tickTime()) / CINEMATIC_SAMPLE_STEP, maxStep);
+        if (share.lastStep == step)
+            return false;
+        share.lastStep = step;
+        return true;
+    }
+    return false;
+}
+
 void Map::CreatePlayerOnClient(Player* player)
 {
     // update player state for other player and visa-versa
@@ -1300,6 +1368,21 @@ void Map::UpdateObjectVisibility(WorldObject* obj, Cell cell, const CellPair& ce
             player->UpdateVisibilityOf(player->GetCamera().GetBody(), obj);
 }
 
+// visibility update of objects close to center, for all of them the cells in visibility range are visited once
+void Map::UpdateObjectsVisibility(std::vector<WorldObject*> const& objects, WorldObject const& center, float radius)
+{
+    CellPair p = MaNGOS::ComputeCellPair(center.GetPositionX(), center.GetPositionY());
+    Cell cell(p);
+    cell.SetNoCreate();
+    MaNGOS::VisibleChangesGroupNotifier notifier(objects);
+    TypeContainerVisitor<MaNGOS::VisibleChangesGroupNotifier, WorldTypeMapContainer > player_notifier(notifier);
+    cell.Visit(p, player_notifier, *this, center, radius);
+    for (size_t i = 0; i < objects.size(); ++i)
+        for (auto guid : notifier.m_unvisitedGuids[i])
+            if (Player* player = GetPlayer(guid))
+                player->UpdateVisibilityOf(player->GetCamera().GetBody(), objects[i]);
+}
+
 void Map::SendInitSelf(Player* player) const
 {
     DETAIL_LOG("Creating player data for himself %u", player->GetGUIDLow());
@@ -2371,12 +2454,18 @@ void Map::SendObjectUpdates()
 {
     UpdateDataMapType update_players;
 
-    while (!i_objectsToClientUpdate.empty())
+    // queue may grow while building update data, so don't cache its size
+    for (size_t i = 0; i < i_objectsToClientUpdate.size(); ++i)
     {
-        Object* obj = *i_objectsToClientUpdate.begin();
-        i_objectsToClientUpdate.erase(i_objectsToClientUpdate.begin());
+        Object* obj = i_objectsToClientUpdate[i];
+        if (!obj)
+            continue;
+
+        i_objectsToClientUpdate[i] = nullptr;
+        obj->SetClientUpdateSlot(CLIENT_UPDATE_SLOT_NONE);
         obj->BuildUpdateData(update_players);
     }
+    i_objectsToClientUpdate.clear();
 
     for (auto& update_player : update_players)
     {
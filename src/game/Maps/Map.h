@@ -37,6 +37,7 @@
 #include "Multithreading/Messager.h"
 #include "Globals/GraveyardManager.h"
 #include "Maps/SpawnManager.h"
+#include "Maps/TriggerVolumeManager.h"
 #include "Maps/MapDataContainer.h"
 #include "World/WorldStateVariableManager.h"
 
@@ -60,6 +61,7 @@ class GridMap;
 class GameObjectModel;
 class WeatherSystem;
 class GenericTransport;
+class ChasePathCache;
 namespace MaNGOS { struct ObjectUpdater; }
 class Transport;
 
@@ -186,6 +188,13 @@ class Map : public GridRefManager<NGridType>
         bool GetUnloadLock(const GridPair& p) const { return getNGrid(p.x_coord, p.y_coord)->getUnloadLock(); }
         void SetUnloadLock(const GridPair& p, bool on) { getNGrid(p.x_coord, p.y_coord)->setUnloadExplicitLock(on); }
         void ForceLoadGrid(float x, float y);
+
+        // Cinematic camera objects, shared by players starting the same cinematic in the same update step
+        Creature* AcquireCinematicObject(Player* player, uint32 cameraId, Position const& pos);
+        // must be called from this map's update, use the messager from other threads
+        void ReleaseCinematicObject(ObjectGuid guid);
+        // step of the object counted from its shared start, returns false if it was already moved to it for another viewer
+        bool AdvanceCinematicObject(Creature* object, uint32 maxStep, uint32& step);
         bool UnloadGrid(const uint32& x, const uint32& y, bool pForce);
         virtual void UnloadAll(bool pForce);
 
@@ -241,10 +250,23 @@ class Map : public GridRefManager<NGridType>
         void AddObjectToRemoveList(WorldObject* obj);
 
         void UpdateObjectVisibility(WorldObject* obj, Cell cell, const CellPair& cellpair);
+        void UpdateObjectsVisibility(std::vector<WorldObject*> const& objects, WorldObject const& center, float radius);
 
-        void resetMarkedCells() { marked_cells.reset(); }
-        bool isCellMarked(uint32 pCellId) const { return marked_cells.test(pCellId); }
-        void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
+        // only words touched since last reset are cleared, idle maps pay nothing for the 512x512 cell grid
+        void resetMarkedCells()
+        {
+            for (uint32 word : m_markedCellWords)
+                marked_cells[word] = 0;
+            m_markedCellWords.clear();
+        }
+        bool isCellMarked(uint32 pCellId) const { return (marked_cells[pCellId / 64] & (uint64(1) << (pCellId % 64))) != 0; }
+        void markCell(uint32 pCellId)
+        {
+            uint64& word = marked_cells[pCellId / 64];
+            if (!word)
+                m_markedCellWords.push_back(pCellId / 64);
+            word |= uint64(1) << (pCellId % 64);
+        }
 
         bool HavePlayers() const { return !m_mapRefManager.isEmpty(); }
         uint32 GetPlayersCountExceptGMs() const;
@@ -305,12 +327,22 @@ class Map : public GridRefManager<NGridType>
 
         void AddUpdateObject(Object* obj)
         {
-            i_objectsToClientUpdate.insert(obj);
+            if (obj->GetClientUpdateSlot() != CLIENT_UPDATE_SLOT_NONE)
+                return;
+
+            obj->SetClientUpdateSlot(i_objectsToClientUpdate.size());
+            i_objectsToClientUpdate.push_back(obj);
         }
 
         void RemoveUpdateObject(Object* obj)
         {
-            i_objectsToClientUpdate.erase(obj);
+            uint32 slot = obj->GetClientUpdateSlot();
+            // object can be queued in other map (item of teleported owner), leave that queue alone
+            if (slot >= i_objectsToClientUpdate.size() || i_objectsToClientUpdate[slot] != obj)
+                return;
+
+            i_objectsToClientUpdate[slot] = nullptr;
+            obj->SetClientUpdateSlot(CLIENT_UPDATE_SLOT_NONE);
         }
 
         // DynObjects currently
@@ -391,6 +423,10 @@ class Map : public GridRefManager<NGridType>
 
         SpawnManager& GetSpawnManager() { return m_spawnManager; }
 
+        TriggerVolumeManager& GetTriggerVolumeManager() { return m_triggerVolumeManager; }
+
+        ChasePathCache& GetChasePathCache() { return *m_chasePathCache; }
+
         MapDataContainer& GetMapDataContainer() { return m_dataContainer; }
         MapDataContainer const& GetMapDataContainer() const { return m_dataContainer; }
         WorldStateVariableManager& GetVariableManager() { return m_variableManager; }
@@ -448,7 +484,8 @@ class Map : public GridRefManager<NGridType>
         void ScriptsProcess();
 
         void SendObjectUpdates();
-        std::set<Object*> i_objectsToClientUpdate;
+        // flat queue of objects with changed fields, removed entries are left as nullptr until next send
+        std::vector<Object*> i_objectsToClientUpdate;
 
     protected:
         MapEntry const* i_mapEntry;
@@ -485,7 +522,8 @@ class Map : public GridRefManager<NGridType>
         TerrainInfo* const m_TerrainData;
         bool m_bLoadedGrids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
 
-        std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP* TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
+        uint64 marked_cells[TOTAL_NUMBER_OF_CELLS_PER_MAP * TOTAL_NUMBER_OF_CELLS_PER_MAP / 64];
+        std::vector<uint32> m_markedCellWords;              // indexes of non zero marked_cells words
 
         WorldObjectSet i_objectsToRemove;
 
@@ -512,6 +550,17 @@ class Map : public GridRefManager<NGridType>
         // Holder for information about linked mobs
         CreatureLinkingHolder m_creatureLinkingHolder;
 
+        struct CinematicObjectShare
+        {
+            ObjectGuid guid;
+            Creature* object;
+            uint32 cameraId;
+            uint32 startTime;                               // world tick time of the first viewer, all viewers follow it
+            uint32 viewers;
+            uint32 lastStep;
+        };
+        std::vector<CinematicObjectShare> m_cinematicObjects;
+
         // Dynamic Map tree object
         DynamicMapTree m_dyn_tree;
 
@@ -527,6 +576,11 @@ class Map : public GridRefManager<NGridType>
         // spawning
         SpawnManager m_spawnManager;
 
+        // trap and persistent area effect activation areas
+        TriggerVolumeManager m_triggerVolumeManager;
+
+        ChasePathCache* m_chasePathCache;
+
         MapDataContainer m_dataContainer;
         std::shared_ptr<CreatureSpellListContainer> m_spellListContainer;
 
@@ -73,6 +73,10 @@ void MapPersistentState::SaveCreatureRespawnTime(uint32 loguid, time_t t)
 {
     SetCreatureRespawnTime(loguid, t);
 
+    // spawn groups sleep until a member respawn time changes
+    if (Map* map = GetMap())
+        map->GetSpawnManager().OnRespawnTimeChanged(TYPEID_UNIT, loguid);
+
     // BGs/Arenas always reset at server restart/unload, so no reason store in DB
     if (GetMapEntry()->IsBattleGroundOrArena())
         return;
@@ -98,6 +102,10 @@ void MapPersistentState::SaveGORespawnTime(uint32 loguid, time_t t)
 {
     SetGORespawnTime(loguid, t);
 
+    // spawn groups sleep until a member respawn time changes
+    if (Map* map = GetMap())
+        map->GetSpawnManager().OnRespawnTimeChanged(TYPEID_GAMEOBJECT, loguid);
+
     // BGs/Arenas always reset at server restart/unload, so no reason store in DB
     if (GetMapEntry()->IsBattleGroundOrArena())
         return;
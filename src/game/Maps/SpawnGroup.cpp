@@ -41,6 +41,7 @@ void SpawnGroup::AddObject(uint32 dbGuid, uint32 entry)
 void SpawnGroup::RemoveObject(WorldObject* wo)
 {
     m_objects.erase(wo->GetDbGuid());
+    m_map.GetSpawnManager().ScheduleSpawnGroup(this);
 
     if (!m_map.IsDungeon() && m_objects.empty() && m_entry.HasChancedSpawns)
     {
@@ -70,6 +71,13 @@ void SpawnGroup::Update()
     Spawn(false);
 }
 
+void SpawnGroup::SetEnabled(bool enabled)
+{
+    m_enabled = enabled;
+    if (m_enabled)
+        m_map.GetSpawnManager().ScheduleSpawnGroup(this);
+}
+
 uint32 SpawnGroup::GetEligibleEntry(std::map<uint32, uint32>& existingEntries, std::map<uint32, uint32>& minEntries)
 {
     if (m_entry.RandomEntries.empty())
@@ -167,14 +175,22 @@ void SpawnGroup::Spawn(bool force)
     }
 
     time_t now = time(nullptr);
+    time_t nextRespawnTime = 0;
     for (auto itr = eligibleGuids.begin(); itr != eligibleGuids.end();)
     {
-        if (m_map.GetPersistentState()->GetObjectRespawnTime(GetObjectTypeId(), (*itr)->DbGuid) > now)
+        time_t respawnTime = m_map.GetPersistentState()->GetObjectRespawnTime(GetObjectTypeId(), (*itr)->DbGuid);
+        if (respawnTime > now)
         {
             if (!force)
             {
+                // nothing else can change until the first cooldown runs out - wake up then
+                if (!nextRespawnTime || respawnTime < nextRespawnTime)
+                    nextRespawnTime = respawnTime;
                 if (m_entry.MaxCount == 1) // rare mob case - prevent respawn until all are off CD
+                {
+                    m_map.GetSpawnManager().ScheduleSpawnGroup(this, m_map.GetCurrentClockTime() + std::chrono::seconds(nextRespawnTime - now));
                     return;
+                }
                 itr = eligibleGuids.erase(itr);
                 continue;
             }
@@ -184,6 +200,9 @@ void SpawnGroup::Spawn(bool force)
         ++itr;
     }
 
+    if (nextRespawnTime)
+        m_map.GetSpawnManager().ScheduleSpawnGroup(this, m_map.GetCurrentClockTime() + std::chrono::seconds(nextRespawnTime - now));
+
     for (auto itr = eligibleGuids.begin(); itr != eligibleGuids.end();)
     {
         uint32 spawnMask = 0; // safeguarded on db load
@@ -414,6 +433,7 @@ void CreatureGroup::SetFormationData(FormationEntrySPtr fEntry)
     {
         m_formationData = std::make_shared<FormationData>(this, fEntry);
         m_formationData->Reset();
+        m_map.GetSpawnManager().AddFormationGroup(this);
     }
     else
     {
@@ -422,9 +442,8 @@ void CreatureGroup::SetFormationData(FormationEntrySPtr fEntry)
     }
 }
 
-void CreatureGroup::Update()
+void CreatureGroup::UpdateFormation()
 {
-    SpawnGroup::Update();
     if (m_formationData)
         m_formationData->Update();
 }
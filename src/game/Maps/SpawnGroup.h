@@ -50,7 +50,7 @@ class SpawnGroup
         virtual void Despawn() = 0;
         std::string to_string() const;
         uint32 GetObjectTypeId() const { return m_objectTypeId; }
-        void SetEnabled(bool enabled) { m_enabled = enabled; }
+        void SetEnabled(bool enabled);
         SpawnGroupEntry const& GetGroupEntry() const { return m_entry; }
         uint32 GetGroupId() const { return m_entry.Id; }
 
@@ -81,7 +81,7 @@ class CreatureGroup : public SpawnGroup
         FormationData* GetFormationData() { return m_formationData.get(); }
         FormationEntrySPtr GetFormationEntry() const { return m_entry.formationEntry; }
 
-        virtual void Update() override;
+        void UpdateFormation();
 
         virtual CreatureGroup* GetCreatureGroup() override { return this; }
 
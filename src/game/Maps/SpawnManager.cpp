@@ -72,6 +72,14 @@ void SpawnManager::Initialize()
         else
             spawnGroup = new GameObjectGroup(entry, m_map);
         m_spawnGroups.emplace(entry.Id, spawnGroup);
+
+        if (entry.WorldStateCondition)
+            m_worldStateGroups.push_back(spawnGroup);
+        else
+            ScheduleSpawnGroup(spawnGroup);
+
+        if (entry.formationEntry)
+            AddFormationGroup(static_cast<CreatureGroup*>(spawnGroup));
     }
 }
 
@@ -163,8 +171,24 @@ void SpawnManager::Update()
             ++itr;
     }
 
-    for (auto& group : m_spawnGroups)
-        group.second->Update();
+    std::vector<SpawnGroup*> dueGroups;
+    while (!m_groupEvaluations.empty() && m_groupEvaluations.begin()->first <= now)
+    {
+        uint32 groupId = m_groupEvaluations.begin()->second;
+        m_groupEvaluations.erase(m_groupEvaluations.begin());
+        m_scheduledGroups.erase(groupId);
+        dueGroups.push_back(m_spawnGroups[groupId]);
+    }
+
+    // evaluation can reschedule the group, so queue is not touched while spawning
+    for (SpawnGroup* group : dueGroups)
+        group->Update();
+
+    for (SpawnGroup* group : m_worldStateGroups)
+        group->Update();
+
+    for (CreatureGroup* group : m_formationGroups)
+        group->UpdateFormation();
 }
 
 std::string SpawnManager::GetRespawnList()
@@ -207,3 +231,37 @@ void SpawnManager::RespawnSpawnGroupsInVicinity(Position pos, float range)
     for (auto& data : m_spawnGroups)
         data.second->RespawnIfInVicinity(pos, range);
 }
+
+void SpawnManager::ScheduleSpawnGroup(SpawnGroup* group, TimePoint when)
+{
+    if (group->GetGroupEntry().WorldStateCondition)
+        return;
+
+    uint32 groupId = group->GetGroupId();
+    auto itr = m_scheduledGroups.find(groupId);
+    if (itr != m_scheduledGroups.end())
+    {
+        if (itr->second <= when)
+            return;
+
+        m_groupEvaluations.erase(std::make_pair(itr->second, groupId));
+        itr->second = when;
+    }
+    else
+        m_scheduledGroups.emplace(groupId, when);
+
+    m_groupEvaluations.emplace(when, groupId);
+}
+
+void SpawnManager::OnRespawnTimeChanged(uint32 typeId, uint32 dbguid)
+{
+    if (SpawnGroupEntry* entry = m_map.GetMapDataContainer().GetSpawnGroupByGuid(dbguid, typeId))
+        if (SpawnGroup* group = GetSpawnGroup(entry->Id))
+            ScheduleSpawnGroup(group);
+}
+
+void SpawnManager::AddFormationGroup(CreatureGroup* group)
+{
+    if (std::find(m_formationGroups.begin(), m_formationGroups.end(), group) == m_formationGroups.end())
+        m_formationGroups.push_back(group);
+}
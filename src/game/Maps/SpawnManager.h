@@ -24,6 +24,7 @@
 #include "Maps/SpawnGroup.h"
 
 #include <string>
+#include <set>
 
 class Map;
 
@@ -70,11 +71,21 @@ class SpawnManager
         SpawnGroup* GetSpawnGroup(uint32 Id);
 
         void RespawnSpawnGroupsInVicinity(Position pos, float range);
+
+        // queues group for Spawn evaluation, earliest pending time wins
+        void ScheduleSpawnGroup(SpawnGroup* group, TimePoint when = TimePoint());
+        void OnRespawnTimeChanged(uint32 typeId, uint32 dbguid);
+        void AddFormationGroup(CreatureGroup* group);
     private:
         Map& m_map;
 
         std::vector<SpawnInfo> m_spawns; // must only be erased from in Update
         std::map<uint32, SpawnGroup*> m_spawnGroups;
+
+        std::set<std::pair<TimePoint, uint32>> m_groupEvaluations;
+        std::map<uint32, TimePoint> m_scheduledGroups;
+        std::vector<SpawnGroup*> m_worldStateGroups;  // no worldstate change hook, polled every tick
+        std::vector<CreatureGroup*> m_formationGroups;
 };
 
 #endif
\ No newline at end of file
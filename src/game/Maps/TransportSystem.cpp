@@ -39,7 +39,8 @@ TransportBase::TransportBase(WorldObject* owner) :
     m_lastPosition(owner->GetPositionX(), owner->GetPositionY(), owner->GetPositionZ(), owner->GetOrientation()),
     m_sinO(sin(m_lastPosition.o)),
     m_cosO(cos(m_lastPosition.o)),
-    m_updatePositionsTimer(500)
+    m_updatePositionsTimer(500),
+    m_isUpdatingGlobalPositions(false)
 {
     MANGOS_ASSERT(m_owner);
 }
@@ -81,9 +82,22 @@ void TransportBase::UpdateGlobalPositions()
     }
 
     // Update global positions
+    m_isUpdatingGlobalPositions = true;
     for (PassengerMap::const_iterator itr = m_passengers.begin(); itr != m_passengers.end(); ++itr)
         UpdateGlobalPositionOf(itr->first, itr->second->GetLocalPositionX(), itr->second->GetLocalPositionY(),
                                itr->second->GetLocalPositionZ(), itr->second->GetLocalOrientation());
+    m_isUpdatingGlobalPositions = false;
+
+    // Passengers stay within their seat offsets of the owner, so one visit around it serves all of them
+    if (!m_pendingVisibilityUpdates.empty())
+    {
+        float radius = 0.0f;
+        for (WorldObject* passenger : m_pendingVisibilityUpdates)
+            radius = std::max(radius, passenger->GetVisibilityData().GetVisibilityDistance() + passenger->GetDistance2d(m_owner));
+
+        m_owner->GetMap()->UpdateObjectsVisibility(m_pendingVisibilityUpdates, *m_owner, radius);
+        m_pendingVisibilityUpdates.clear();
+    }
 
     m_lastPosition = pos;
 }
@@ -70,6 +70,10 @@ class TransportBase
         // Helper function to check if a unit is boarded onto this transporter (or a transporter boarded onto this)*
         bool HasOnBoard(WorldObject const* passenger) const;
 
+        // While UpdateGlobalPositions relocates the passengers their visibility updates are collected and done together
+        bool IsUpdatingGlobalPositions() const { return m_isUpdatingGlobalPositions; }
+        void AddPendingVisibilityUpdate(WorldObject* passenger) { m_pendingVisibilityUpdates.push_back(passenger); }
+
     protected:
         // Helper functions to add/ remove a passenger from the list
         void BoardPassenger(WorldObject* passenger, float lx, float ly, float lz, float lo, uint8 seat);
@@ -82,6 +86,9 @@ class TransportBase
         Position m_lastPosition;
         float m_sinO, m_cosO;
         uint32 m_updatePositionsTimer;                      ///< Timer that is used to trigger updates for global coordinate calculations
+
+        bool m_isUpdatingGlobalPositions;
+        std::vector<WorldObject*> m_pendingVisibilityUpdates;
 };
 
 /**
@@ -109,6 +116,15 @@ class TransportInfo
         // Helper function if a passenger is already boarded somewhere onto the boarded transports
         bool HasOnBoard(WorldObject const* passenger) const { return m_transport->HasOnBoard(passenger); }
 
+        // Returns true if the visibility update of the relocated passenger is left to the transporter
+        bool DeferVisibilityUpdate() const
+        {
+            if (!m_transport->IsUpdatingGlobalPositions())
+                return false;
+            m_transport->AddPendingVisibilityUpdate(m_owner);
+            return true;
+        }
+
         // Get local position and seat
         uint8 GetTransportSeat() const { return m_seat; }
         float GetLocalOrientation() const { return m_localPosition.o; }
@@ -0,0 +1,123 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Maps/TriggerVolumeManager.h"
+#include "Maps/GridDefines.h"
+#include "Entities/Unit.h"
+
+#include <algorithm>
+
+// largest unit combat reach still covered by the cells a volume is stored in, bigger units rely on the recheck
+#define TRIGGER_VOLUME_MAX_UNIT_REACH 10.0f
+
+static inline uint32 GetCellKey(CellPair const& cell)
+{
+    return cell.x_coord * TOTAL_NUMBER_OF_CELLS_PER_MAP + cell.y_coord;
+}
+
+bool TriggerVolume::ConsumeTrigger(TimePoint const& now)
+{
+    if (!m_triggered && now < m_nextRecheck)
+        return false;
+
+    m_triggered = false;
+    m_nextRecheck = now + std::chrono::milliseconds(TRIGGER_VOLUME_RECHECK_INTERVAL);
+    return true;
+}
+
+void TriggerVolumeManager::Add(TriggerVolume& volume, float x, float y, float radius, float reach)
+{
+    if (volume.m_registered)
+        Remove(volume);
+
+    volume.m_x = x;
+    volume.m_y = y;
+    volume.m_radius = radius;
+    volume.m_reach = reach;
+    volume.m_triggered = true;
+    volume.m_registered = true;
+
+    float range = radius + reach + TRIGGER_VOLUME_MAX_UNIT_REACH;
+    float lowX = x - range, lowY = y - range, highX = x + range, highY = y + range;
+    MaNGOS::NormalizeMapCoord(lowX);
+    MaNGOS::NormalizeMapCoord(lowY);
+    MaNGOS::NormalizeMapCoord(highX);
+    MaNGOS::NormalizeMapCoord(highY);
+
+    CellPair low = MaNGOS::ComputeCellPair(lowX, lowY);
+    CellPair high = MaNGOS::ComputeCellPair(highX, highY);
+    for (uint32 cellX = low.x_coord; cellX <= high.x_coord; ++cellX)
+    {
+        for (uint32 cellY = low.y_coord; cellY <= high.y_coord; ++cellY)
+        {
+            uint32 key = GetCellKey(CellPair(cellX, cellY));
+            m_cellVolumes[key].push_back(&volume);
+            volume.m_cells.push_back(key);
+        }
+    }
+}
+
+void TriggerVolumeManager::Remove(TriggerVolume& volume)
+{
+    if (!volume.m_registered)
+        return;
+
+    for (uint32 key : volume.m_cells)
+    {
+        CellTriggerVolumeMap::iterator itr = m_cellVolumes.find(key);
+        if (itr == m_cellVolumes.end())
+            continue;
+
+        TriggerVolumeList& list = itr->second;
+        TriggerVolumeList::iterator found = std::find(list.begin(), list.end(), &volume);
+        if (found != list.end())
+        {
+            *found = list.back();
+            list.pop_back();
+        }
+
+        if (list.empty())
+            m_cellVolumes.erase(itr);
+    }
+
+    volume.m_cells.clear();
+    volume.m_registered = false;
+}
+
+void TriggerVolumeManager::OnUnitRelocated(Unit const& unit)
+{
+    if (m_cellVolumes.empty())
+        return;
+
+    CellTriggerVolumeMap::const_iterator itr = m_cellVolumes.find(GetCellKey(MaNGOS::ComputeCellPair(unit.GetPositionX(), unit.GetPositionY())));
+    if (itr == m_cellVolumes.end())
+        return;
+
+    float unitReach = unit.GetCombatReach();
+    for (TriggerVolume* volume : itr->second)
+    {
+        if (volume->m_triggered)
+            continue;
+
+        float dx = unit.GetPositionX() - volume->m_x;
+        float dy = unit.GetPositionY() - volume->m_y;
+        float range = volume->m_radius + volume->m_reach + unitReach;
+        if (dx * dx + dy * dy <= range * range)
+            volume->m_triggered = true;
+    }
+}
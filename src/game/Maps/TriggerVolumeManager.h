@@ -0,0 +1,78 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_TRIGGER_VOLUME_MANAGER_H
+#define MANGOS_TRIGGER_VOLUME_MANAGER_H
+
+#include "Common.h"
+
+#include <unordered_map>
+#include <vector>
+
+class Unit;
+
+// (msecs) a volume is searched at least this often even if no unit moved inside,
+// catches units which become valid targets without moving or are added to the map inside it
+#define TRIGGER_VOLUME_RECHECK_INTERVAL 1000
+
+/*
+ * Circular activation area of a trap or persistent area effect, owned by that object.
+ * The map's TriggerVolumeManager flags it whenever a unit moves inside, so the owner
+ * only searches the grid when something may have entered it.
+ */
+class TriggerVolume
+{
+        friend class TriggerVolumeManager;
+
+    public:
+        TriggerVolume() : m_x(0.0f), m_y(0.0f), m_radius(0.0f), m_reach(0.0f), m_triggered(false), m_registered(false) {}
+
+        bool IsRegistered() const { return m_registered; }
+        bool IsAt(float x, float y, float radius) const { return m_x == x && m_y == y && m_radius == radius; }
+
+        // true when a unit moved inside since the last call or the recheck interval passed
+        bool ConsumeTrigger(TimePoint const& now);
+
+    private:
+        float m_x;
+        float m_y;
+        float m_radius;
+        float m_reach;                                      // owner bounding radius, added to the activation range
+        bool m_triggered;
+        bool m_registered;
+        TimePoint m_nextRecheck;
+        std::vector<uint32> m_cells;                        // cells the volume is stored in
+};
+
+class TriggerVolumeManager
+{
+    public:
+        // (re)registers the volume at given position, it starts triggered
+        void Add(TriggerVolume& volume, float x, float y, float radius, float reach);
+        void Remove(TriggerVolume& volume);
+
+        void OnUnitRelocated(Unit const& unit);
+
+    private:
+        typedef std::vector<TriggerVolume*> TriggerVolumeList;
+        typedef std::unordered_map<uint32, TriggerVolumeList> CellTriggerVolumeMap;
+
+        CellTriggerVolumeMap m_cellVolumes;
+};
+
+#endif
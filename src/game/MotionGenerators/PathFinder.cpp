@@ -35,7 +35,7 @@
 PathFinder::PathFinder(const Unit* owner, bool ignoreNormalization) :
     m_polyLength(0), m_type(PATHFIND_BLANK),
     m_useStraightPath(false), m_forceDestination(false), m_straightLine(false), m_pointPathLimit(MAX_POINT_PATH_LENGTH), // TODO: Fix legitimate long paths
-    m_sourceUnit(owner), m_navMesh(nullptr), m_navMeshQuery(nullptr), m_cachedPoints(m_pointPathLimit * VERTEX_SIZE), m_pathPolyRefs(m_pointPathLimit), m_smoothPathPolyRefs(m_pointPathLimit), m_defaultMapId(m_sourceUnit->GetMapId()), m_ignoreNormalization(ignoreNormalization)
+    m_sourceUnit(owner), m_chaseTarget(nullptr), m_navMesh(nullptr), m_navMeshQuery(nullptr), m_cachedPoints(m_pointPathLimit * VERTEX_SIZE), m_pathPolyRefs(m_pointPathLimit), m_smoothPathPolyRefs(m_pointPathLimit), m_defaultMapId(m_sourceUnit->GetMapId()), m_ignoreNormalization(ignoreNormalization)
 {
     DEBUG_FILTER_LOG(LOG_FILTER_PATHFINDING, "++ PathFinder::PathInfo for %u \n", m_sourceUnit->GetGUIDLow());
 
@@ -454,7 +454,9 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
         // free and invalidate old path data
         clear();
 
-        if (!m_straightLine)
+        if (!m_straightLine && BuildChasePolyPath(startPoly, endPoly))
+            dtResult = DT_SUCCESS;
+        else if (!m_straightLine)
         {
             dtResult = m_navMeshQuery->findPath(
                     startPoly,          // start polygon
@@ -519,6 +521,106 @@ void PathFinder::BuildPolyPath(const Vector3& startPos, const Vector3& endPos)
     BuildPointPath(startPoint, endPoint);
 }
 
+bool PathFinder::BuildChasePolyPath(dtPolyRef startPoly, dtPolyRef endPoly)
+{
+    ChasePathField const* field = GetChasePathField();
+    if (!field)
+        return false;
+
+    uint32 maxLength = std::min<uint32>(m_pointPathLimit, m_pathPolyRefs.size());
+    dtPolyRef poly = startPoly;
+    m_polyLength = 0;
+    while (m_polyLength < maxLength)
+    {
+        // tiles may have been reloaded since the tree was built, offmesh links are not guaranteed to be two way
+        dtMeshTile const* tile;
+        dtPoly const* polyData;
+        if (dtStatusFailed(m_navMesh->getTileAndPolyByRef(poly, &tile, &polyData)) || polyData->getType() == DT_POLYTYPE_OFFMESH_CONNECTION)
+            break;
+
+        m_pathPolyRefs[m_polyLength++] = poly;
+        if (poly == endPoly)
+            return true;
+
+        if (poly == field->targetPoly)
+        {
+            // destination is usually right next to the target - accept a direct child of the target polygon
+            auto itr = field->parents.find(endPoly);
+            if (itr == field->parents.end() || itr->second != poly || m_polyLength >= maxLength)
+                break;
+
+            m_pathPolyRefs[m_polyLength++] = endPoly;
+            return true;
+        }
+
+        auto itr = field->parents.find(poly);
+        if (itr == field->parents.end() || itr->second == INVALID_POLYREF)
+            break;
+
+        poly = itr->second;
+    }
+
+    m_polyLength = 0;
+    return false;
+}
+
+ChasePathField const* PathFinder::GetChasePathField()
+{
+    if (!m_chaseTarget || m_sourceUnit->GetTransport() || m_chaseTarget->GetTransport() || m_navMeshQuery != m_defaultNavMeshQuery)
+        return nullptr;
+
+    float x, y, z;
+    m_chaseTarget->GetPosition(x, y, z);
+    float targetPoint[VERTEX_SIZE] = {y, z, x};
+    float extents[VERTEX_SIZE] = {5.0f, 5.0f, 5.0f};
+    dtPolyRef targetPoly = INVALID_POLYREF;
+    if (dtStatusFailed(m_navMeshQuery->findNearestPoly(targetPoint, extents, &m_filter, &targetPoly, nullptr)) || targetPoly == INVALID_POLYREF)
+        return nullptr;
+
+    uint32 now = WorldTimer::getMSTime();
+    uint32 filterFlags = (uint32(m_filter.getIncludeFlags()) << 16) | m_filter.getExcludeFlags();
+    ChasePathField& field = m_sourceUnit->GetMap()->GetChasePathCache().GetField(m_chaseTarget->GetObjectGuid(), filterFlags, now);
+
+    // tree stays valid while the target remains on its polygon
+    if (field.query == m_navMeshQuery && field.targetPoly == targetPoly && WorldTimer::getMSTimeDiff(field.buildTime, now) < CHASE_PATH_FIELD_LIFETIME)
+        return &field;
+
+    dtPolyRef refs[CHASE_PATH_FIELD_MAX_POLYS];
+    dtPolyRef parents[CHASE_PATH_FIELD_MAX_POLYS];
+    int count = 0;
+    field.targetPoly = INVALID_POLYREF;
+    field.parents.clear();
+    if (dtStatusFailed(m_navMeshQuery->findPolysAroundCircle(targetPoly, targetPoint, CHASE_PATH_FIELD_RADIUS, &m_filter, refs, parents, nullptr, &count, CHASE_PATH_FIELD_MAX_POLYS)))
+        return nullptr;
+
+    for (int i = 0; i < count; ++i)
+        field.parents.emplace(refs[i], parents[i]);
+
+    field.query = m_navMeshQuery;
+    field.targetPoly = targetPoly;
+    field.buildTime = now;
+    return &field;
+}
+
+ChasePathField& ChasePathCache::GetField(ObjectGuid target, uint32 filterFlags, uint32 now)
+{
+    auto key = std::make_pair(target, filterFlags);
+    auto itr = m_fields.find(key);
+    if (itr != m_fields.end())
+        return itr->second;
+
+    // drop trees of targets nobody chased for a while before adding a new one
+    for (auto fieldItr = m_fields.begin(); fieldItr != m_fields.end();)
+    {
+        if (WorldTimer::getMSTimeDiff(fieldItr->second.buildTime, now) >= CHASE_PATH_FIELD_LIFETIME)
+            fieldItr = m_fields.erase(fieldItr);
+        else
+            ++fieldItr;
+    }
+
+    return m_fields[key];
+}
+
 void PathFinder::BuildPointPath(const float* startPoint, const float* endPoint)
 {
     if (m_pointPathLimit * VERTEX_SIZE > m_cachedPoints.size())
@@ -25,6 +25,10 @@
 #include <Detour/Include/DetourNavMeshQuery.h>
 
 #include "Movement/MoveSplineInitArgs.h"
+#include "Entities/ObjectGuid.h"
+
+#include <map>
+#include <unordered_map>
 
 using Movement::Vector3;
 using Movement::PointsArray;
@@ -49,6 +53,11 @@ class Unit;
 #define VERTEX_SIZE             3
 #define INVALID_POLYREF         0
 
+// shared chase corridors - search radius around the chased unit, polygon limit and rebuild interval
+#define CHASE_PATH_FIELD_RADIUS     60.0f
+#define CHASE_PATH_FIELD_MAX_POLYS  512
+#define CHASE_PATH_FIELD_LIFETIME   5000
+
 enum PathType
 {
     PATHFIND_BLANK          = 0x0000,   // path not built yet
@@ -60,6 +69,28 @@ enum PathType
     PATHFIND_SHORT          = 0x0020,   // path is longer or equal to its limited path length
 };
 
+// Dijkstra tree grown from the polygon of a chased unit, every chaser on the map
+// walks its corridor towards the target from here instead of running findPath
+struct ChasePathField
+{
+    ChasePathField() : query(nullptr), targetPoly(INVALID_POLYREF), buildTime(0) {}
+
+    dtNavMeshQuery const* query;
+    dtPolyRef targetPoly;
+    uint32 buildTime;
+    std::unordered_map<dtPolyRef, dtPolyRef> parents;  // polygon -> next polygon towards target
+};
+
+class ChasePathCache
+{
+    public:
+        // key is target guid and filter flags, chasers with different movement capabilities can't share
+        ChasePathField& GetField(ObjectGuid target, uint32 filterFlags, uint32 now);
+
+    private:
+        std::map<std::pair<ObjectGuid, uint32>, ChasePathField> m_fields;
+};
+
 class PathFinder
 {
     public:
@@ -74,6 +105,7 @@ class PathFinder
         // option setters - use optional
         void setUseStrightPath(bool useStraightPath) { m_useStraightPath = useStraightPath; };
         void setPathLengthLimit(float distance) { m_pointPathLimit = std::min<uint32>(uint32(distance / SMOOTH_PATH_STEP_SIZE * 1.25f), MAX_POINT_PATH_LENGTH); };
+        void setChaseTarget(Unit const* target) { m_chaseTarget = target; }
 
         // result getters
         Vector3 getStartPosition()      const { return m_startPosition; }
@@ -103,6 +135,7 @@ class PathFinder
         Vector3        m_actualEndPosition;// {x, y, z} of the closest possible point to given destination
 
         const Unit* const       m_sourceUnit;       // the unit that is moving
+        const Unit*             m_chaseTarget;      // set by chase movement, enables shared corridors
         const dtNavMesh*        m_navMesh;          // the nav mesh
         const dtNavMeshQuery*   m_navMeshQuery;     // the nav mesh query used to find the path
 
@@ -134,6 +167,8 @@ class PathFinder
         bool HaveTile(const Vector3& p) const;
 
         void BuildPolyPath(const Vector3& startPos, const Vector3& endPos);
+        bool BuildChasePolyPath(dtPolyRef startPoly, dtPolyRef endPoly);
+        ChasePathField const* GetChasePathField();
         void BuildPointPath(const float* startPoint, const float* endPoint);
         void BuildShortcut();
 
@@ -492,6 +492,7 @@ bool ChaseMovementGenerator::DispatchSplineToPosition(Unit& owner, float x, floa
 
     if (!this->i_path)
         this->i_path = new PathFinder(&owner);
+    this->i_path->setChaseTarget(this->i_target.getTarget()); // chasers of one target share its corridor tree
 
     bool gen = false;
     if (owner.IsWithinDist3d(x, y, z, 200.f) && std::abs(owner.GetPositionZ() - z) < 5.f && owner.IsWithinLOS(x, y, z + i_target->GetCollisionHeight()) && !owner.IsInWater() && !i_target->IsInWater())
@@ -202,37 +202,24 @@ void ReputationMgr::SendState(FactionState const* faction, bool anyRankIncreased
 
 void ReputationMgr::SendInitialReputations()
 {
-    WorldPacket data(SMSG_INITIALIZE_FACTIONS, (4 + 128 * 5));
-    data << uint32(0x00000080);
-
-    RepListID a = 0;
+    WorldPacket data(SMSG_INITIALIZE_FACTIONS, (4 + MAX_INITIAL_FACTIONS * 5));
+    data << uint32(MAX_INITIAL_FACTIONS);
+    data.append(m_initialFactionsData);
 
     for (auto& m_faction : m_factions)
-    {
-        // fill in absent fields
-        for (; a != m_faction.first; ++a)
-        {
-            data << uint8(0x00);
-            data << uint32(0x00000000);
-        }
-
-        // fill in encountered data
-        data << uint8(m_faction.second.Flags);
-        data << uint32(m_faction.second.Standing);
-
         m_faction.second.needSend = false;
 
-        ++a;
-    }
+    m_player->SendDirectMessage(data);
+}
 
-    // fill in absent fields
-    for (; a != 128; ++a)
-    {
-        data << uint8(0x00);
-        data << uint32(0x00000000);
-    }
+void ReputationMgr::UpdateInitialFactionData(FactionState const* faction)
+{
+    if (faction->ReputationListID >= MAX_INITIAL_FACTIONS || m_initialFactionsData.size() < MAX_INITIAL_FACTIONS * 5)
+        return;
 
-    m_player->SendDirectMessage(data);
+    size_t pos = faction->ReputationListID * 5;
+    m_initialFactionsData.put<uint8>(pos, uint8(faction->Flags));
+    m_initialFactionsData.put<uint32>(pos + 1, uint32(faction->Standing));
 }
 
 void ReputationMgr::SendVisible(FactionState const* faction) const
@@ -249,6 +236,9 @@ void ReputationMgr::SendVisible(FactionState const* faction) const
 void ReputationMgr::Initialize()
 {
     m_factions.clear();
+    m_changedFactions.clear();
+    m_initialFactionsData.clear();
+    m_initialFactionsData.resize(MAX_INITIAL_FACTIONS * 5);  // absent factions are sent zeroed
     m_visibleFactionCount = 0;
     m_honoredFactionCount = 0;
     m_reveredFactionCount = 0;
@@ -267,6 +257,7 @@ void ReputationMgr::Initialize()
             newFaction.Flags = GetDefaultStateFlags(factionEntry);
             newFaction.needSend = true;
             newFaction.needSave = true;
+            m_changedFactions.push_back(newFaction.ReputationListID);
 
             if (newFaction.Flags & FACTION_FLAG_VISIBLE)
                 ++m_visibleFactionCount;
@@ -274,6 +265,7 @@ void ReputationMgr::Initialize()
             UpdateRankCounters(REP_HOSTILE, GetBaseRank(factionEntry));
 
             m_factions[newFaction.ReputationListID] = newFaction;
+            UpdateInitialFactionData(&newFaction);
         }
     }
 }
@@ -383,7 +375,8 @@ bool ReputationMgr::SetOneFactionReputation(FactionEntry const* factionEntry, in
 
         faction.Standing = standing - BaseRep;
         faction.needSend = true;
-        faction.needSave = true;
+        UpdateInitialFactionData(&faction);
+        SetNeedSave(&faction);
 
         SetVisible(&faction);
 
@@ -451,7 +444,8 @@ void ReputationMgr::SetVisible(FactionState* faction)
 
     faction->Flags |= FACTION_FLAG_VISIBLE;
     faction->needSend = true;
-    faction->needSave = true;
+    UpdateInitialFactionData(faction);
+    SetNeedSave(faction);
 
     ++m_visibleFactionCount;
 
@@ -490,7 +484,8 @@ void ReputationMgr::SetAtWar(FactionState* faction, bool atWar)
         faction->Flags &= ~uint32(FACTION_FLAG_AT_WAR);
 
     faction->needSend = true;
-    faction->needSave = true;
+    UpdateInitialFactionData(faction);
+    SetNeedSave(faction);
 }
 
 void ReputationMgr::SetInactive(RepListID repListID, bool on)
@@ -521,7 +516,8 @@ void ReputationMgr::SetInactive(FactionState* faction, bool inactive)
         faction->Flags &= ~FACTION_FLAG_INACTIVE;
 
     faction->needSend = true;
-    faction->needSave = true;
+    UpdateInitialFactionData(faction);
+    SetNeedSave(faction);
 }
 
 void ReputationMgr::LoadFromDB(QueryResult* result)
@@ -544,6 +540,7 @@ void ReputationMgr::LoadFromDB(QueryResult* result)
 
                 // update standing to current
                 faction->Standing = int32(fields[1].GetUInt32());
+                UpdateInitialFactionData(faction);
 
                 // update counters
                 int32 BaseRep = GetBaseReputation(factionEntry);
@@ -594,22 +591,32 @@ void ReputationMgr::LoadFromDB(QueryResult* result)
 
 void ReputationMgr::SaveToDB()
 {
-    static SqlStatementID delRep ;
-    static SqlStatementID insRep ;
+    // single upsert per changed faction, the save transaction sends them as one multi-row request
+    static SqlStatementID saveRep ;
 
-    SqlStatement stmtDel = CharacterDatabase.CreateStatement(delRep, "DELETE FROM character_reputation WHERE guid = ? AND faction=?");
-    SqlStatement stmtIns = CharacterDatabase.CreateStatement(insRep, "INSERT INTO character_reputation (guid,faction,standing,flags) VALUES (?, ?, ?, ?)");
+    SqlStatement stmt = CharacterDatabase.CreateStatement(saveRep, "REPLACE INTO character_reputation (guid,faction,standing,flags) VALUES (?, ?, ?, ?)");
 
-    for (auto& m_faction : m_factions)
+    for (RepListID repListID : m_changedFactions)
     {
-        FactionState& faction = m_faction.second;
-        if (faction.needSave)
-        {
-            stmtDel.PExecute(m_player->GetGUIDLow(), faction.ID);
-            stmtIns.PExecute(m_player->GetGUIDLow(), faction.ID, faction.Standing, faction.Flags);
-            faction.needSave = false;
-        }
+        FactionStateList::iterator itr = m_factions.find(repListID);
+        if (itr == m_factions.end() || !itr->second.needSave)
+            continue;                                       // duplicate entry or reset by LoadFromDB
+
+        FactionState& faction = itr->second;
+        stmt.PExecute(m_player->GetGUIDLow(), faction.ID, faction.Standing, faction.Flags);
+        faction.needSave = false;
     }
+
+    m_changedFactions.clear();
+}
+
+void ReputationMgr::SetNeedSave(FactionState* faction)
+{
+    if (faction->needSave)
+        return;
+
+    faction->needSave = true;
+    m_changedFactions.push_back(faction->ReputationListID);
 }
 
 void ReputationMgr::UpdateRankCounters(ReputationRank old_rank, ReputationRank new_rank)
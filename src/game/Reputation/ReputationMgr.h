@@ -22,6 +22,7 @@
 #include "Common.h"
 #include "Globals/SharedDefines.h"
 #include "Server/DBCStructure.h"
+#include "ByteBuffer.h"
 #include <map>
 
 enum FactionFlags
@@ -36,6 +37,8 @@ enum FactionFlags
     FACTION_FLAG_TEAM_REPUTATION    = 0x80                  // faction has own reputation standing despite teaming up sub-factions; spillover from subfactions will go this instead of other subfactions
 };
 
+#define MAX_INITIAL_FACTIONS 128                            // reputation list size of SMSG_INITIALIZE_FACTIONS
+
 typedef uint32 RepListID;
 struct FactionState
 {
@@ -125,6 +128,8 @@ class ReputationMgr
         void SetInactive(FactionState* faction, bool inactive);
         void SendVisible(FactionState const* faction) const;
         void UpdateRankCounters(ReputationRank old_rank, ReputationRank new_rank);
+        void UpdateInitialFactionData(FactionState const* faction);
+        void SetNeedSave(FactionState* faction);
     private:
         Player* m_player;
         FactionStateList m_factions;
@@ -133,6 +138,10 @@ class ReputationMgr
         uint8 m_honoredFactionCount : 8;
         uint8 m_reveredFactionCount : 8;
         uint8 m_exaltedFactionCount : 8;
+
+        // SMSG_INITIALIZE_FACTIONS body, kept up to date at each flags/standing change
+        ByteBuffer m_initialFactionsData;
+        std::vector<RepListID> m_changedFactions;           // factions with needSave set since last save, may repeat
 };
 
 #endif
@@ -457,7 +457,7 @@ Aura::~Aura()
 
 AreaAura::AreaAura(SpellEntry const* spellproto, SpellEffectIndex eff, int32 const* currentDamage, int32 const* currentBasePoints, SpellAuraHolder* holder, Unit* target,
                    Unit* caster, Item* castItem, uint32 originalRankSpellId)
-    : Aura(spellproto, eff, currentDamage, currentBasePoints, holder, target, caster, castItem), m_originalRankSpellId(originalRankSpellId)
+    : Aura(spellproto, eff, currentDamage, currentBasePoints, holder, target, caster, castItem), m_originalRankSpellId(originalRankSpellId), m_targetScanTimer(0)
 {
     m_isAreaAura = true;
 
@@ -594,8 +594,16 @@ void AreaAura::Update(uint32 diff)
     {
         Unit* caster = GetTarget();
 
-        if (!caster->hasUnitState(UNIT_STAT_ISOLATED))
+        // new targets are searched in intervals, auras already applied check their own validity on every update
+        if (m_targetScanTimer > diff)
+            m_targetScanTimer -= diff;
+        else
+            m_targetScanTimer = 0;
+
+        if (!m_targetScanTimer && !caster->hasUnitState(UNIT_STAT_ISOLATED))
         {
+            m_targetScanTimer = AREA_AURA_TARGET_SCAN_INTERVAL;
+
             Unit* owner = caster->GetMaster();
             if (!owner)
                 owner = caster;
@@ -6676,6 +6684,7 @@ void Aura::HandleAuraModStat(bool apply, bool /*Real*/)
             target->RemoveAurasTriggeredBySpell(GetId(), GetCasterGuid()); // just do it every time, lookup is too time consuming
     }
 
+    target->DeferStatUpdates();
     for (int32 i = STAT_STRENGTH; i < MAX_STATS; ++i)
     {
         // -1 or -2 is all stats ( misc < -2 checked in function beginning )
@@ -6688,6 +6697,7 @@ void Aura::HandleAuraModStat(bool apply, bool /*Real*/)
                 target->ApplyStatBuffMod(Stats(i), amount, apply);
         }
     }
+    target->ResumeStatUpdates();
 }
 
 void Aura::HandleModPercentStat(bool apply, bool /*Real*/)
@@ -6702,11 +6712,13 @@ void Aura::HandleModPercentStat(bool apply, bool /*Real*/)
     if (GetTarget()->GetTypeId() != TYPEID_PLAYER)
         return;
 
+    GetTarget()->DeferStatUpdates();
     for (int32 i = STAT_STRENGTH; i < MAX_STATS; ++i)
     {
         if (m_modifier.m_miscvalue == i || m_modifier.m_miscvalue == -1)
             GetTarget()->HandleStatModifier(UnitMods(UNIT_MOD_STAT_START + i), BASE_PCT, float(m_modifier.m_amount), apply);
     }
+    GetTarget()->ResumeStatUpdates();
 }
 
 void Aura::HandleModSpellDamagePercentFromStat(bool /*apply*/, bool /*Real*/)
@@ -6778,6 +6790,7 @@ void Aura::HandleModTotalPercentStat(bool apply, bool /*Real*/)
     uint32 curHPValue = target->GetHealth();
     uint32 maxHPValue = target->GetMaxHealth();
 
+    target->DeferStatUpdates();
     for (int32 i = STAT_STRENGTH; i < MAX_STATS; ++i)
     {
         if (m_modifier.m_miscvalue == i || m_modifier.m_miscvalue == -1)
@@ -6787,6 +6800,7 @@ void Aura::HandleModTotalPercentStat(bool apply, bool /*Real*/)
                 target->ApplyStatPercentBuffMod(Stats(i), float(m_modifier.m_amount), apply);
         }
     }
+    target->ResumeStatUpdates();
 
     // recalculate current HP/MP after applying aura modifications (only for spells with 0x10 flag)
     if (m_modifier.m_miscvalue == STAT_STAMINA && maxHPValue > 0 && GetSpellProto()->HasAttribute(SPELL_ATTR_ABILITY))
@@ -605,6 +605,9 @@ class Aura
         void ReapplyAffectedPassiveAuras(Unit* target, bool owner_mode);
 };
 
+// (msecs) interval in which area auras search for new targets
+#define AREA_AURA_TARGET_SCAN_INTERVAL 500
+
 class AreaAura : public Aura
 {
     public:
@@ -616,6 +619,7 @@ class AreaAura : public Aura
         float m_radius;
         AreaAuraType m_areaAuraType;
         uint32       m_originalRankSpellId;
+        uint32       m_targetScanTimer;
 };
 
 class PersistentAreaAura : public Aura
@@ -2981,6 +2981,50 @@ SpellCastResult SpellMgr::GetSpellAllowedInLocationError(SpellEntry const* spell
     return SPELL_CAST_OK;
 }
 
+bool SpellMgr::IsSpellLocationRestricted(SpellEntry const* spellInfo) const
+{
+    // keep in sync with the checks of GetSpellAllowedInLocationError
+    if (spellInfo->AreaGroupId > 0 ||
+            spellInfo->HasAttribute(SPELL_ATTR_EX4_CAST_ONLY_IN_OUTLAND) ||
+            spellInfo->HasAttribute(SPELL_ATTR_EX6_NOT_IN_RAID_INSTANCE) ||
+            spellInfo->HasAttribute(SPELL_ATTR_EX3_BATTLEGROUND) ||
+            spellInfo->HasAttribute(SPELL_ATTR_EX4_NOT_USABLE_IN_ARENA))
+        return true;
+
+    if (GetSpellRecoveryTime(spellInfo) > 10 * MINUTE * IN_MILLISECONDS && !spellInfo->HasAttribute(SPELL_ATTR_EX4_USABLE_IN_ARENA))
+        return true;
+
+    SpellAreaMapBounds saBounds = GetSpellAreaMapBounds(spellInfo->Id);
+    if (saBounds.first != saBounds.second)
+        return true;
+
+    switch (spellInfo->Id)
+    {
+        case 22564:                                         // recall
+        case 22563:                                         // recall
+        case 23333:                                         // Warsong Flag
+        case 23335:                                         // Silverwing Flag
+        case 34976:                                         // Netherstorm Flag
+        case 2584:                                          // Waiting to Resurrect
+        case 42792:                                         // Recently Dropped Flag
+        case 44521:                                         // Preparation
+        case 22011:                                         // Spirit Heal Channel
+        case 22012:                                         // Spirit Heal
+        case 24171:                                         // Resurrection Impact Visual
+        case 44535:                                         // Spirit Heal (mana)
+        case 32724:                                         // Gold Team (Alliance)
+        case 32725:                                         // Green Team (Alliance)
+        case 35774:                                         // Gold Team (Horde)
+        case 35775:                                         // Green Team (Horde)
+        case 32727:                                         // Arena Preparation
+        case 74410:                                         // Arena - Dampening
+        case 74411:                                         // Battleground - Dampening
+            return true;
+        default:
+            return false;
+    }
+}
+
 void SpellMgr::LoadSkillLineAbilityMaps()
 {
     mSkillLineAbilityMapBySpellId.clear();
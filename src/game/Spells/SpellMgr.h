@@ -3262,6 +3262,8 @@ class SpellMgr
         }
 
         SpellCastResult GetSpellAllowedInLocationError(SpellEntry const* spellInfo, uint32 map_id, uint32 zone_id, uint32 area_id, Player const* player = nullptr) const;
+        // true if GetSpellAllowedInLocationError can fail for the spell
+        bool IsSpellLocationRestricted(SpellEntry const* spellInfo) const;
 
         SpellAreaMapBounds GetSpellAreaMapBounds(uint32 spell_id) const
         {
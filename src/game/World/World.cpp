@@ -627,7 +627,8 @@ void World::LoadConfigSettings(bool reload)
 
     setConfig(CONFIG_UINT32_MAIL_DELIVERY_DELAY, "MailDeliveryDelay", HOUR);
 
-    setConfigMin(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK, "MassMailer.SendPerTick", 10, 1);
+    setConfigMinMax(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK, "MassMailer.SendPerTick", 500, 1, 5000);
+    setConfigMin(CONFIG_UINT32_MASS_MAILER_MAX_QUEUED, "MassMailer.MaxQueuedBatches", 4, 1);
 
     setConfig(CONFIG_UINT32_UPTIME_UPDATE, "UpdateUptimeInterval", 10);
     if (reload)
@@ -983,6 +984,7 @@ void World::SetInitialWorldSettings()
     // Loading cameras for characters creation cinematic
     sLog.outString("Loading cinematic...");
     LoadM2Cameras(m_dataPath);
+    CinematicMgr::LoadCameraSamples();
 
     sLog.outString("Loading Script Names...");
     sScriptDevAIMgr.LoadScriptNames();
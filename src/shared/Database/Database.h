@@ -36,6 +36,8 @@ class SqlParamBinder;
 class Database;
 
 #define MAX_QUERY_LEN   (32*1024)
+// upper bound for coalesced/pipelined requests sent by a transaction, stays well below default max_allowed_packet
+#define MAX_BATCH_QUERY_LEN   (1024*1024)
 
 //
 class SqlConnection
@@ -52,6 +54,12 @@ class SqlConnection
         // public methods for making requests
         virtual bool Execute(const char* sql) = 0;
 
+        // several ';' separated requests sent in one round trip, stops at the first failing one
+        virtual bool CanExecuteMultiple() const { return false; }
+        virtual bool ExecuteMultiple(const char* sql) { return Execute(sql); }
+        // allows ExecuteMultiple until switched off again, requests sent to the server are added to requests
+        virtual bool SetExecuteMultiple(bool /*on*/, uint32& /*requests*/) { return true; }
+
         // escape string generation
         virtual unsigned long escape_string(char* to, const char* from, unsigned long length) { strncpy(to, from, length); return length; }
 
@@ -81,6 +89,8 @@ class SqlConnection
         Database& DB() const { return m_db; }
 
     protected:
+        friend class SqlTransaction;
+
         SqlConnection(Database& db) : m_db(db) {}
 
         virtual SqlPreparedStatement* CreateStatement(const std::string& fmt);
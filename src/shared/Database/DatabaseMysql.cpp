@@ -261,6 +261,58 @@ bool MySQLConnection::Execute(const char* sql)
     return true;
 }
 
+bool MySQLConnection::ExecuteMultiple(const char* sql)
+{
+    if (!mMysql)
+        return false;
+
+    uint32 _s = WorldTimer::getMSTime();
+
+    bool success = true;
+    if (mysql_query(mMysql, sql))
+        success = false;
+    else
+    {
+        // consume status of every statement, server stops processing at the first failed one
+        int status;
+        do
+        {
+            if (MYSQL_RES* result = mysql_store_result(mMysql))
+                mysql_free_result(result);
+            status = mysql_next_result(mMysql);
+        }
+        while (status == 0);
+
+        success = status < 0;
+    }
+
+    if (!success)
+    {
+        sLog.outErrorDb("SQL: %s", sql);
+        sLog.outErrorDb("SQL ERROR: %s", mysql_error(mMysql));
+    }
+
+    if (success)
+        DEBUG_FILTER_LOG(LOG_FILTER_SQL_TEXT, "[%u ms] SQL: %s", WorldTimer::getMSTimeDiff(_s, WorldTimer::getMSTime()), sql);
+    return success;
+}
+
+bool MySQLConnection::SetExecuteMultiple(bool on, uint32& requests)
+{
+    if (!mMysql)
+        return false;
+
+    // the option is a server round trip of its own
+    ++requests;
+    if (mysql_set_server_option(mMysql, on ? MYSQL_OPTION_MULTI_STATEMENTS_ON : MYSQL_OPTION_MULTI_STATEMENTS_OFF))
+    {
+        sLog.outErrorDb("SQL ERROR: %s", mysql_error(mMysql));
+        return false;
+    }
+
+    return true;
+}
+
 bool MySQLConnection::_TransactionCmd(const char* sql)
 {
     if (mysql_query(mMysql, sql))
@@ -73,6 +73,10 @@ class MySQLConnection : public SqlConnection
         QueryNamedResult* QueryNamed(const char* sql) override;
         bool Execute(const char* sql) override;
 
+        bool CanExecuteMultiple() const override { return true; }
+        bool ExecuteMultiple(const char* sql) override;
+        bool SetExecuteMultiple(bool on, uint32& requests) override;
+
         unsigned long escape_string(char* to, const char* from, unsigned long length);
 
         bool BeginTransaction() override;
@@ -44,6 +44,9 @@ class PostgreSQLConnection : public SqlConnection
         QueryNamedResult* QueryNamed(const char* sql) override;
         bool Execute(const char* sql) override;
 
+        // PQexec accepts several ';' separated commands natively
+        bool CanExecuteMultiple() const override { return true; }
+
         unsigned long escape_string(char* to, const char* from, unsigned long length);
 
         bool BeginTransaction() override;
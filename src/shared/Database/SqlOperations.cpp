@@ -52,21 +52,128 @@ bool SqlTransaction::Execute(SqlConnection* conn)
 
     conn->BeginTransaction();
 
+    bool const canPipeline = conn->CanExecuteMultiple();
+    std::string pipeline;
+    uint32 pipelined = 0;
+    uint32 roundTrips = 0;
+    bool multiple = false;
+
+    // multi statements are only switched on while this transaction runs
+    auto rollback = [&]()
+    {
+        if (multiple)
+            conn->SetExecuteMultiple(false, roundTrips);
+        conn->RollbackTransaction();
+        return false;
+    };
+
+    std::string request;
     const int nItems = m_queue.size();
-    for (int i = 0; i < nItems; ++i)
+    for (int i = 0; i < nItems;)
     {
         SqlOperation* pStmt = m_queue[i];
+        request.clear();
 
-        if (!pStmt->Execute(conn))
+        if (SqlPreparedRequest* pPrepared = dynamic_cast<SqlPreparedRequest*>(pStmt))
         {
-            conn->RollbackTransaction();
-            return false;
+            SqlPreparedStatement* pPrepStmt = pPrepared->GetIndex() != -1 ? conn->GetStmt(pPrepared->GetIndex()) : nullptr;
+            if (pPrepStmt && pPrepStmt->isBatchable())
+            {
+                // merge all following executes of the same statement into one multi-row request
+                pPrepStmt->AppendBatchRow(pPrepared->GetParams(), request);
+                for (++i; i < nItems && request.length() < MAX_BATCH_QUERY_LEN; ++i)
+                {
+                    SqlPreparedRequest* pNext = dynamic_cast<SqlPreparedRequest*>(m_queue[i]);
+                    if (!pNext || pNext->GetIndex() != pPrepared->GetIndex())
+                        break;
+
+                    pPrepStmt->AppendBatchRow(pNext->GetParams(), request);
+                }
+            }
+            else if (pPrepStmt && canPipeline)
+            {
+                pPrepStmt->AppendPlainRequest(pPrepared->GetParams(), request);
+                ++i;
+            }
+        }
+        else if (SqlPlainRequest* pPlain = dynamic_cast<SqlPlainRequest*>(pStmt))
+        {
+            if (canPipeline)
+            {
+                request = pPlain->GetSql();
+                // trailing separator would produce an empty statement in the middle of the pipeline
+                request.erase(request.find_last_not_of(" \t\r\n;") + 1);
+                ++i;
+
+                // nothing to execute, don't let it reach the fallback below
+                if (request.empty())
+                    continue;
+            }
+        }
+
+        if (request.empty())
+        {
+            // can't be merged with anything, keep order by sending everything collected so far first
+            if (!FlushPipeline(conn, pipeline, pipelined, roundTrips, multiple) || !pStmt->Execute(conn))
+                return rollback();
+
+            ++roundTrips;
+            ++i;
+            continue;
+        }
+
+        if (!canPipeline)
+        {
+            if (!conn->Execute(request.c_str()))
+                return rollback();
+
+            ++roundTrips;
+            continue;
         }
+
+        if (pipeline.length() + request.length() >= MAX_BATCH_QUERY_LEN && !FlushPipeline(conn, pipeline, pipelined, roundTrips, multiple))
+            return rollback();
+
+        if (!pipeline.empty())
+            pipeline += ';';
+        pipeline += request;
+        ++pipelined;
     }
 
+    if (!FlushPipeline(conn, pipeline, pipelined, roundTrips, multiple))
+        return rollback();
+
+    if (multiple && !conn->SetExecuteMultiple(false, roundTrips))
+    {
+        multiple = false;
+        return rollback();
+    }
+
+    DEBUG_FILTER_LOG(LOG_FILTER_SQL_TEXT, "SqlTransaction: %i operations sent in %u requests", nItems, roundTrips);
+
     return conn->CommitTransaction();
 }
 
+bool SqlTransaction::FlushPipeline(SqlConnection* conn, std::string& pipeline, uint32& pipelined, uint32& roundTrips, bool& multiple)
+{
+    if (pipeline.empty())
+        return true;
+
+    if (pipelined > 1 && !multiple)
+    {
+        if (!conn->SetExecuteMultiple(true, roundTrips))
+            return false;
+        multiple = true;
+    }
+
+    bool const result = pipelined > 1 ? conn->ExecuteMultiple(pipeline.c_str()) : conn->Execute(pipeline.c_str());
+
+    pipeline.clear();
+    pipelined = 0;
+    ++roundTrips;
+    return result;
+}
+
 SqlPreparedRequest::SqlPreparedRequest(int nIndex, SqlStmtParameters* arg) : m_nIndex(nIndex), m_param(arg)
 {
 }
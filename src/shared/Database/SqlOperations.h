@@ -52,6 +52,8 @@ class SqlPlainRequest : public SqlOperation
         SqlPlainRequest(const char* sql) : m_sql(mangos_strdup(sql)) {}
         ~SqlPlainRequest() { char* tofree = const_cast<char*>(m_sql); delete[] tofree; }
         bool Execute(SqlConnection* conn) override;
+
+        const char* GetSql() const { return m_sql; }
 };
 
 class SqlTransaction : public SqlOperation
@@ -65,7 +67,12 @@ class SqlTransaction : public SqlOperation
 
         void DelayExecute(SqlOperation* sql) { m_queue.push_back(sql); }
 
+        // consecutive executes of one INSERT/REPLACE statement are coalesced into multi-row requests
+        // and, when backend supports it, independent requests are pipelined into a single round trip
         bool Execute(SqlConnection* conn) override;
+
+    private:
+        bool FlushPipeline(SqlConnection* conn, std::string& pipeline, uint32& pipelined, uint32& roundTrips, bool& multiple);
 };
 
 class SqlPreparedRequest : public SqlOperation
@@ -76,6 +83,9 @@ class SqlPreparedRequest : public SqlOperation
 
         bool Execute(SqlConnection* conn) override;
 
+        int GetIndex() const { return m_nIndex; }
+        const SqlStmtParameters& GetParams() const { return *m_param; }
+
     private:
         const int m_nIndex;
         SqlStmtParameters* m_param;
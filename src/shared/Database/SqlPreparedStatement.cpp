@@ -18,6 +18,9 @@
 
 #include "DatabaseEnv.h"
 
+#include <iomanip>
+#include <limits>
+
 SqlStmtParameters::SqlStmtParameters(uint32 nParams)
 {
     // reserve memory if needed
@@ -84,56 +87,97 @@ bool SqlStatement::DirectExecute()
 }
 
 //////////////////////////////////////////////////////////////////////////
-SqlPlainPreparedStatement::SqlPlainPreparedStatement(const std::string& fmt, SqlConnection& conn) : SqlPreparedStatement(fmt, conn)
+// returns position of the VALUES tuple if it is the last clause of an INSERT/REPLACE statement
+static size_t FindBatchValuesTuple(const std::string& fmt, size_t& tupleEnd)
 {
-    m_bPrepared = true;
-    m_nParams = std::count(m_szFmt.begin(), m_szFmt.end(), '?');
-    m_bIsQuery = strnicmp(m_szFmt.c_str(), "select", 6) == 0;
-}
+    if (strnicmp(fmt.c_str(), "insert", 6) != 0 && strnicmp(fmt.c_str(), "replace", 7) != 0)
+        return std::string::npos;
 
-void SqlPlainPreparedStatement::bind(const SqlStmtParameters& holder)
-{
-    // verify if we bound all needed input parameters
-    if (m_nParams != holder.boundParams())
-    {
-        MANGOS_ASSERT(false);
-        return;
-    }
+    std::string lowered = fmt;
+    std::transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
 
-    // reset resulting plain SQL request
-    m_szPlainRequest = m_szFmt;
-    size_t nLastPos = 0;
+    size_t nPos = lowered.find("values");
+    while (nPos != std::string::npos && (!isspace(lowered[nPos - 1]) && lowered[nPos - 1] != ')'))
+        nPos = lowered.find("values", nPos + 6);
 
-    SqlStmtParameters::ParameterContainer const& _args = holder.params();
-
-    SqlStmtParameters::ParameterContainer::const_iterator iter_last = _args.end();
-    for (SqlStmtParameters::ParameterContainer::const_iterator iter = _args.begin(); iter != iter_last; ++iter)
-    {
-        // bind parameter
-        const SqlStmtFieldData& data = (*iter);
+    if (nPos == std::string::npos)
+        return std::string::npos;
 
-        std::ostringstream fmt;
-        DataToString(data, fmt);
+    nPos = lowered.find_first_not_of(" \t\r\n", nPos + 6);
+    if (nPos == std::string::npos || lowered[nPos] != '(')
+        return std::string::npos;
 
-        nLastPos = m_szPlainRequest.find('?', nLastPos);
-        if (nLastPos != std::string::npos)
+    // tuple must be closed at the very end, so "ON DUPLICATE KEY UPDATE" and similar are left alone
+    size_t nLast = lowered.find_last_not_of(" \t\r\n;");
+    int nDepth = 0;
+    for (size_t i = nPos; i <= nLast; ++i)
+    {
+        if (lowered[i] == '(')
+            ++nDepth;
+        else if (lowered[i] == ')' && --nDepth == 0)
         {
-            std::string tmp = fmt.str();
-            m_szPlainRequest.replace(nLastPos, 1, tmp);
-            nLastPos += tmp.length();
+            if (i != nLast)
+                return std::string::npos;
+
+            tupleEnd = nLast + 1;
+            return nPos;
         }
     }
+
+    return std::string::npos;
 }
 
-bool SqlPlainPreparedStatement::execute()
+SqlPreparedStatement::SqlPreparedStatement(const std::string& fmt, SqlConnection& conn) :
+    m_nParams(0), m_nColumns(0), m_bIsQuery(false),
+    m_bPrepared(false), m_szFmt(fmt), m_pConn(conn), m_nValuesEnd(0)
 {
-    if (m_szPlainRequest.empty())
-        return false;
+    m_nValuesPos = FindBatchValuesTuple(m_szFmt, m_nValuesEnd);
+}
 
-    return m_pConn.Execute(m_szPlainRequest.c_str());
+void SqlPreparedStatement::AppendPlainRequest(const SqlStmtParameters& holder, std::string& sql) const
+{
+    AppendBound(holder, 0, m_szFmt.length(), sql);
 }
 
-void SqlPlainPreparedStatement::DataToString(const SqlStmtFieldData& data, std::ostringstream& fmt) const
+void SqlPreparedStatement::AppendBatchRow(const SqlStmtParameters& holder, std::string& sql) const
+{
+    MANGOS_ASSERT(isBatchable());
+
+    if (sql.empty())
+        sql.append(m_szFmt, 0, m_nValuesPos);
+    else
+        sql += ',';
+
+    AppendBound(holder, m_nValuesPos, m_nValuesEnd, sql);
+}
+
+void SqlPreparedStatement::AppendBound(const SqlStmtParameters& holder, size_t begin, size_t end, std::string& sql) const
+{
+    SqlStmtParameters::ParameterContainer const& _args = holder.params();
+    SqlStmtParameters::ParameterContainer::const_iterator iter = _args.begin();
+
+    std::ostringstream fmt;
+    while (begin < end)
+    {
+        size_t nPos = m_szFmt.find('?', begin);
+        if (nPos == std::string::npos || nPos >= end || iter == _args.end())
+        {
+            sql.append(m_szFmt, begin, end - begin);
+            break;
+        }
+
+        sql.append(m_szFmt, begin, nPos - begin);
+
+        // bind parameter
+        fmt.str(std::string());
+        DataToString(*iter++, fmt);
+        sql += fmt.str();
+
+        begin = nPos + 1;
+    }
+}
+
+void SqlPreparedStatement::DataToString(const SqlStmtFieldData& data, std::ostringstream& fmt) const
 {
     switch (data.type())
     {
@@ -146,8 +190,9 @@ void SqlPlainPreparedStatement::DataToString(const SqlStmtFieldData& data, std::
         case FIELD_I16:     fmt << "'" << int32(data.toInt16()) << "'";     break;
         case FIELD_I32:     fmt << "'" << data.toInt32() << "'";            break;
         case FIELD_I64:     fmt << "'" << data.toInt64() << "'";            break;
-        case FIELD_FLOAT:   fmt << "'" << data.toFloat() << "'";            break;
-        case FIELD_DOUBLE:  fmt << "'" << data.toDouble() << "'";           break;
+        // default stream precision (6 digits) would truncate coordinates
+        case FIELD_FLOAT:   fmt << "'" << std::setprecision(std::numeric_limits<float>::max_digits10) << data.toFloat() << "'";   break;
+        case FIELD_DOUBLE:  fmt << "'" << std::setprecision(std::numeric_limits<double>::max_digits10) << data.toDouble() << "'"; break;
         case FIELD_STRING:
         {
             std::string tmp = data.toStr();
@@ -159,3 +204,33 @@ void SqlPlainPreparedStatement::DataToString(const SqlStmtFieldData& data, std::
         default: throw std::domain_error("Unrecognized sql data type");
     }
 }
+
+//////////////////////////////////////////////////////////////////////////
+SqlPlainPreparedStatement::SqlPlainPreparedStatement(const std::string& fmt, SqlConnection& conn) : SqlPreparedStatement(fmt, conn)
+{
+    m_bPrepared = true;
+    m_nParams = std::count(m_szFmt.begin(), m_szFmt.end(), '?');
+    m_bIsQuery = strnicmp(m_szFmt.c_str(), "select", 6) == 0;
+}
+
+void SqlPlainPreparedStatement::bind(const SqlStmtParameters& holder)
+{
+    // verify if we bound all needed input parameters
+    if (m_nParams != holder.boundParams())
+    {
+        MANGOS_ASSERT(false);
+        return;
+    }
+
+    // reset resulting plain SQL request
+    m_szPlainRequest.clear();
+    AppendPlainRequest(holder, m_szPlainRequest);
+}
+
+bool SqlPlainPreparedStatement::execute()
+{
+    if (m_szPlainRequest.empty())
+        return false;
+
+    return m_pConn.Execute(m_szPlainRequest.c_str());
+}
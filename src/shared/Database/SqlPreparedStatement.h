@@ -315,11 +315,17 @@ class SqlPreparedStatement
         // execute statement w/o result set
         virtual bool execute() = 0;
 
+        // INSERT/REPLACE statements with a single trailing VALUES tuple can be sent as one multi-row request
+        bool isBatchable() const { return m_nValuesPos != std::string::npos; }
+        // append plain SQL request with all parameters substituted
+        void AppendPlainRequest(const SqlStmtParameters& holder, std::string& sql) const;
+        // append next row to multi-row request, sql must be empty for the first row
+        void AppendBatchRow(const SqlStmtParameters& holder, std::string& sql) const;
+
     protected:
-        SqlPreparedStatement(const std::string& fmt, SqlConnection& conn) :
-            m_nParams(0), m_nColumns(0), m_bIsQuery(false),
-            m_bPrepared(false), m_szFmt(fmt), m_pConn(conn)
-        {}
+        SqlPreparedStatement(const std::string& fmt, SqlConnection& conn);
+
+        void DataToString(const SqlStmtFieldData& data, std::ostringstream& fmt) const;
 
         uint32 m_nParams;
         uint32 m_nColumns;
@@ -327,6 +333,13 @@ class SqlPreparedStatement
         bool m_bPrepared;
         std::string m_szFmt;
         SqlConnection& m_pConn;
+
+    private:
+        void AppendBound(const SqlStmtParameters& holder, size_t begin, size_t end, std::string& sql) const;
+
+        // position of VALUES tuple in m_szFmt, npos if statement can't be batched
+        size_t m_nValuesPos;
+        size_t m_nValuesEnd;
 };
 
 // prepared statements via plain SQL string requests
@@ -345,8 +358,6 @@ class SqlPlainPreparedStatement : public SqlPreparedStatement
         virtual bool execute() override;
 
     protected:
-        void DataToString(const SqlStmtFieldData& data, std::ostringstream& fmt) const;
-
         std::string m_szPlainRequest;
 };
 
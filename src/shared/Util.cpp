@@ -19,24 +19,39 @@
 #include "Util.h"
 #include "Timer.h"
 #include <utf8.h>
-#include "TSS.h"
 
 #include <boost/asio.hpp>
 
 #include <chrono>
 #include <cstdarg>
+#include <thread>
 
-std::mt19937* initRand()
+RandomGenerator::RandomGenerator()
 {
-    std::seed_seq seq = { size_t(std::time(nullptr)), size_t(std::clock()) };
-    return new std::mt19937(seq);
+    uint64 seed = uint64(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    seed ^= uint64(std::hash<std::thread::id>()(std::this_thread::get_id())) << 1;
+    seed ^= uint64(std::random_device()()) << 32;
+    Seed(seed);
 }
 
-static MaNGOS::thread_local_ptr<std::mt19937> mtRand(&initRand);
+void RandomGenerator::Seed(uint64 seed)
+{
+    // expand the seed with splitmix64, as recommended for xoshiro generators, state can't be all zero
+    for (uint64& state : m_state)
+    {
+        seed += 0x9e3779b97f4a7c15ULL;
+        uint64 z = seed;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        state = z ^ (z >> 31);
+    }
+}
+
+static thread_local RandomGenerator tlsRand;
 
-std::mt19937* GetRandomGenerator()
+RandomGenerator* GetRandomGenerator()
 {
-    return mtRand.get();
+    return &tlsRand;
 }
 
 uint32 WorldTimer::m_iTime = 0;
@@ -67,56 +82,47 @@ uint32 WorldTimer::getMSTime()
 //////////////////////////////////////////////////////////////////////////
 int32 irand(int32 min, int32 max)
 {
-    std::uniform_int_distribution<int32> dist(min, max);
-    return dist(*mtRand.get());
+    return int32(uint32(min) + tlsRand.Bounded(uint32(max) - uint32(min) + 1));
 }
 
 uint32 urand(uint32 min, uint32 max)
 {
-    std::uniform_int_distribution<uint32> dist(min, max);
-    return dist(*mtRand.get());
+    return min + tlsRand.Bounded(max - min + 1);
 }
 
 float frand(float min, float max)
 {
-    std::uniform_real_distribution<float> dist(min, max);
-    return dist(*mtRand.get());
+    return min + (max - min) * float(tlsRand() >> 40) * (1.0f / 16777216.0f);
 }
 
 int32 irand()
 {
-    std::uniform_int_distribution<int32> dist;
-    return dist(*mtRand.get());
+    return int32(tlsRand() >> 33);
 }
 
 uint32 urand()
 {
-    std::uniform_int_distribution<uint32> dist;
-    return dist(*mtRand.get());
+    return uint32(tlsRand() >> 32);
 }
 
 double rand_norm()
 {
-    std::uniform_real_distribution<double> dist(0, 1.0f);
-    return dist(*mtRand.get());
+    return tlsRand.Normalized();
 }
 
 float rand_norm_f()
 {
-    std::uniform_real_distribution<float> dist(0, 1.0f);
-    return dist(*mtRand.get());
+    return float(tlsRand() >> 40) * (1.0f / 16777216.0f);
 }
 
 double rand_chance()
 {
-    std::uniform_real_distribution<double> dist(0, 100.0);
-    return dist(*mtRand.get());
+    return tlsRand.Normalized() * 100.0;
 }
 
 float rand_chance_f()
 {
-    std::uniform_real_distribution<double> dist(0, 100.0);
-    return float(dist(*mtRand.get()));
+    return float(tlsRand.Normalized() * 100.0);
 }
 
 Tokens StrSplit(const std::string& src, const std::string& sep)
@@ -45,7 +45,69 @@ inline uint32 secsToTimeBitFields(time_t secs)
     return (lt->tm_year - 100) << 24 | lt->tm_mon  << 20 | (lt->tm_mday - 1) << 14 | lt->tm_wday << 11 | lt->tm_hour << 6 | lt->tm_min;
 }
 
-std::mt19937* GetRandomGenerator();
+/* Small and fast xoshiro256** generator, each thread uses its own instance in the functions below.
+ * Satisfies UniformRandomBitGenerator, so it can be passed to std::shuffle and the std distributions. */
+class RandomGenerator
+{
+    public:
+        typedef uint64 result_type;
+
+        RandomGenerator();
+        explicit RandomGenerator(uint64 seed) { Seed(seed); }
+
+        void Seed(uint64 seed);
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return ~result_type(0); }
+
+        result_type operator()()
+        {
+            uint64 const result = Rotl(m_state[1] * 5, 7) * 9;
+            uint64 const t = m_state[1] << 17;
+
+            m_state[2] ^= m_state[0];
+            m_state[3] ^= m_state[1];
+            m_state[1] ^= m_state[2];
+            m_state[0] ^= m_state[3];
+            m_state[2] ^= t;
+            m_state[3] = Rotl(m_state[3], 45);
+
+            return result;
+        }
+
+        /* Return an unbiased random number in the range 0..range-1, range 0 stands for the full 32 bit range. */
+        uint32 Bounded(uint32 range)
+        {
+            uint32 x = uint32((*this)() >> 32);
+            if (!range)
+                return x;
+
+            // multiply-shift with rejection of the few low products which would favour some results
+            uint64 m = uint64(x) * range;
+            uint32 low = uint32(m);
+            if (low < range)
+            {
+                uint32 threshold = (~range + 1) % range;
+                while (low < threshold)
+                {
+                    x = uint32((*this)() >> 32);
+                    m = uint64(x) * range;
+                    low = uint32(m);
+                }
+            }
+            return uint32(m >> 32);
+        }
+
+        /* Return a random double from 0.0 to 1.0 (exclusive) using all 53 mantissa bits. */
+        double Normalized() { return double((*this)() >> 11) * (1.0 / 9007199254740992.0); }
+
+    private:
+        static uint64 Rotl(uint64 x, int k) { return (x << k) | (x >> (64 - k)); }
+
+        uint64 m_state[4];
+};
+
+RandomGenerator* GetRandomGenerator();
 
 /* Return a random number in the range min..max; (max-min) must be smaller than 32768. */
 int32 irand(int32 min, int32 max);